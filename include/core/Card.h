@@ -1,6 +1,7 @@
 #ifndef CARD_H
 #define CARD_H
 
+#include <cstdint>
 #include <string>
 
 enum {
@@ -27,20 +28,34 @@ enum {
 };
 
 class Card {
-    int rank_;
-    int suit_;
+    uint8_t index_;
 
 public:
-    Card(int r, int s);
-    Card();
-    std::string toString();
-    int getRank() { return rank_; }
-    int getSuit() { return suit_; }
-    bool operator==(Card other);
-    bool operator!=(Card other);
-    bool operator<(Card other);
+    static const int NUM_CARDS = 52;
+    // Index of a default-constructed Card, which is no card at all rather
+    // than the two of spades it once was. Its bit is 0, so it never enters
+    // or matches a CardSet.
+    static const uint8_t NO_CARD = 0xFF;
+
+    constexpr Card(int r, int s) : index_(static_cast<uint8_t>((r - RANK_TWO) * 4 + s)) {}
+    constexpr Card() : index_(NO_CARD) {}
+    static constexpr Card fromIndex(int index) { return Card(index / 4 + RANK_TWO, index % 4); }
+
+    // "??" for a card that is not one of the 52.
+    std::string toString() const;
+    constexpr bool isValid() const { return index_ < NUM_CARDS; }
+    constexpr int getRank() const { return (index_ >> 2) + RANK_TWO; }
+    constexpr int getSuit() const { return index_ & 3; }
+    constexpr int getIndex() const { return index_; }
+    constexpr uint64_t getBit() const { return isValid() ? 1ull << (getSuit() * 16 + (index_ >> 2)) : 0; }
+
+    constexpr bool operator==(const Card& other) const { return index_ == other.index_; }
+    constexpr bool operator!=(const Card& other) const { return index_ != other.index_; }
+    constexpr bool operator<(const Card& other) const { return index_ < other.index_; }
 };
 
+static_assert(sizeof(Card) == 1, "Card must stay packed into one byte");
+
 #endif
 
 
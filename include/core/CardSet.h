@@ -0,0 +1,65 @@
+#ifndef CARDSET_H
+#define CARDSET_H
+
+#include "Card.h"
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+// 64-bit card mask: bit (suit * 16 + rank - RANK_TWO) is set for each card,
+// so every suit occupies its own 16-bit lane holding a 13-bit rank mask.
+class CardSet {
+    uint64_t mask_;
+
+public:
+    static constexpr uint64_t FULL_DECK = 0x1FFF1FFF1FFF1FFFull;
+
+    class iterator {
+        uint64_t bits_;
+
+    public:
+        constexpr explicit iterator(uint64_t bits) : bits_(bits) {}
+        constexpr Card operator*() const { return CardSet::cardAt(__builtin_ctzll(bits_)); }
+        constexpr iterator& operator++() { bits_ &= bits_ - 1; return *this; }
+        constexpr bool operator!=(const iterator& other) const { return bits_ != other.bits_; }
+        constexpr bool operator==(const iterator& other) const { return bits_ == other.bits_; }
+    };
+
+    constexpr CardSet() : mask_(0) {}
+    constexpr explicit CardSet(uint64_t mask) : mask_(mask) {}
+    explicit CardSet(const std::vector<Card>& cards);
+
+    static constexpr CardSet fullDeck() { return CardSet(FULL_DECK); }
+    static constexpr uint64_t bitOf(Card card) { return card.getBit(); }
+    static constexpr Card cardAt(int bitIndex) { return Card((bitIndex & 15) + RANK_TWO, bitIndex >> 4); }
+
+    constexpr uint64_t mask() const { return mask_; }
+    constexpr int suitMask(int suit) const { return static_cast<int>((mask_ >> (suit * 16)) & 0x1FFF); }
+    constexpr int size() const { return __builtin_popcountll(mask_); }
+    constexpr bool empty() const { return mask_ == 0; }
+
+    constexpr void insert(Card card) {
+        assert(card.isValid());
+        mask_ |= bitOf(card);
+    }
+    constexpr void remove(Card card) { mask_ &= ~bitOf(card); }
+    constexpr bool contains(Card card) const { return (mask_ & bitOf(card)) != 0; }
+    constexpr bool intersects(CardSet other) const { return (mask_ & other.mask_) != 0; }
+    constexpr void clear() { mask_ = 0; }
+
+    std::vector<Card> toCards() const;
+
+    constexpr iterator begin() const { return iterator(mask_); }
+    constexpr iterator end() const { return iterator(0); }
+
+    constexpr CardSet operator|(CardSet other) const { return CardSet(mask_ | other.mask_); }
+    constexpr CardSet operator&(CardSet other) const { return CardSet(mask_ & other.mask_); }
+    constexpr CardSet operator-(CardSet other) const { return CardSet(mask_ & ~other.mask_); }
+    constexpr CardSet& operator|=(CardSet other) { mask_ |= other.mask_; return *this; }
+    constexpr CardSet& operator&=(CardSet other) { mask_ &= other.mask_; return *this; }
+    constexpr CardSet& operator-=(CardSet other) { mask_ &= ~other.mask_; return *this; }
+    constexpr bool operator==(CardSet other) const { return mask_ == other.mask_; }
+    constexpr bool operator!=(CardSet other) const { return mask_ != other.mask_; }
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef COMBINATORICS_H
+#define COMBINATORICS_H
+
+#include <algorithm>
+#include <cstdint>
+
+// Binomial coefficients and colex ranking of k-subsets given as bit masks:
+// the rank of a subset with elements c1 < c2 < ... < ck is
+// C(c1, 1) + C(c2, 2) + ... + C(ck, k), which numbers the C(n, k) subsets
+// of {0..n-1} densely from 0.
+namespace Combinatorics {
+
+// Pascal's triangle for the small n and k that card subsets need.
+struct BinomialTable {
+    static const int MAX_N = 64;
+    static const int MAX_K = 8;
+    uint64_t values[MAX_N][MAX_K];
+
+    constexpr BinomialTable() : values() {
+        for (int n = 0; n < MAX_N; ++n) {
+            values[n][0] = 1;
+            for (int k = 1; k < MAX_K; ++k) {
+                values[n][k] = n == 0 ? 0 : values[n - 1][k - 1] + values[n - 1][k];
+            }
+        }
+    }
+};
+
+inline constexpr BinomialTable BINOMIALS{};
+
+constexpr uint64_t binomial(int n, int k) {
+    if (k < 0 || n < 0 || k > n) return 0;
+    if (n < BinomialTable::MAX_N && k < BinomialTable::MAX_K) return BINOMIALS.values[n][k];
+    if (k > n - k) k = n - k;
+    uint64_t result = 1;
+    for (int i = 1; i <= k; ++i) {
+        result = result * static_cast<uint64_t>(n - k + i) / static_cast<uint64_t>(i);
+    }
+    return result;
+}
+
+constexpr uint64_t colexRank(uint64_t subset) {
+    uint64_t rank = 0;
+    int k = 0;
+    while (subset) {
+        int element = __builtin_ctzll(subset);
+        rank += binomial(element, ++k);
+        subset &= subset - 1;
+    }
+    return rank;
+}
+
+// The k-subset with the given colex rank.
+constexpr uint64_t colexUnrank(uint64_t rank, int k) {
+    uint64_t subset = 0;
+    for (; k > 0; --k) {
+        int element = k - 1;
+        while (binomial(element + 1, k) <= rank) {
+            ++element;
+        }
+        rank -= binomial(element, k);
+        subset |= 1ull << element;
+    }
+    return subset;
+}
+
+// Gosper's hack: the k-subset that follows subset in colex order.
+constexpr uint64_t nextSubset(uint64_t subset) {
+    if (subset == 0) return 0;
+    uint64_t lowest = subset & (~subset + 1);
+    uint64_t ripple = subset + lowest;
+    return (((ripple ^ subset) >> 2) >> __builtin_ctzll(subset)) | ripple;
+}
+
+static_assert(colexRank(colexUnrank(1000, 4)) == 1000, "colex ranking must round-trip");
+static_assert(colexRank(nextSubset(colexUnrank(1000, 4))) == 1001, "nextSubset must follow colex order");
+
+// The k-subsets of {0..n-1} as bit masks in colex order, optionally only
+// the count of them starting at a given colex rank. Nothing is
+// materialised, and any rank range can be walked on its own, so one
+// enumeration can be split into chunks across threads:
+//
+//     for (uint64_t subset : Combinations(n, k)) { ... }
+class Combinations {
+public:
+    class Iterator {
+        uint64_t subset_;
+        uint64_t left_;
+
+    public:
+        constexpr Iterator(uint64_t subset, uint64_t left) : subset_(subset), left_(left) {}
+        constexpr uint64_t operator*() const { return subset_; }
+        constexpr Iterator& operator++() {
+            subset_ = nextSubset(subset_);
+            --left_;
+            return *this;
+        }
+        constexpr bool operator!=(const Iterator& other) const { return left_ != other.left_; }
+    };
+
+    constexpr Combinations(int n, int k) : first_(colexUnrank(0, k)), count_(binomial(n, k)) {}
+    constexpr Combinations(int n, int k, uint64_t firstRank, uint64_t count)
+        : first_(colexUnrank(firstRank, k)),
+          count_(firstRank >= binomial(n, k) ? 0 : std::min(count, binomial(n, k) - firstRank)) {}
+
+    // Ranks [total * part / parts, total * (part + 1) / parts).
+    static constexpr Combinations slice(int n, int k, int part, int parts) {
+        uint64_t total = binomial(n, k);
+        uint64_t begin = total * part / parts;
+        uint64_t end = total * (part + 1) / parts;
+        return Combinations(n, k, begin, end - begin);
+    }
+
+    constexpr uint64_t size() const { return count_; }
+    constexpr Iterator begin() const { return Iterator(first_, count_); }
+    constexpr Iterator end() const { return Iterator(0, 0); }
+
+private:
+    uint64_t first_;
+    uint64_t count_;
+};
+
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef DEALSAMPLER_H
+#define DEALSAMPLER_H
+
+#include "Card.h"
+#include "CardSet.h"
+#include <cstdint>
+
+// Random partial deals, eight at a time. A deal is a fixed list of card
+// groups (a board runout, then each opponent's hole cards) drawn without
+// replacement from the cards not in dead, and comes back as one card mask
+// per group.
+//
+// Each lane owns a xoshiro128** generator and the mask of bits it may not
+// deal: the dead cards, the cards it has dealt and the twelve bits of the
+// mask that are not cards. A card is a uniform six-bit position in the
+// mask, taken again if it is blocked, which samples the live cards
+// uniformly without replacement. Every 32-bit draw holds CANDIDATES
+// positions and the lane keeps the first free one, so it seldom needs a
+// second draw for a card even late in a deal.
+//
+// The lanes move in step, one card at a time. The AVX2 kernel advances all
+// eight generators in one register and tests every lane's candidates at
+// once; the scalar kernel runs the same steps lane by lane, so both give
+// the same deals from the same seed. The kernel is chosen once, at
+// construction, when the CPU has AVX2.
+class DealSampler {
+public:
+    static const int LANES = 8;
+    static const int MAX_GROUPS = 10;
+    static const int CANDIDATES = 4;
+
+    // Groups that do not fit in the live cards are dealt empty.
+    DealSampler(CardSet dead, const int* groupSizes, int groups, uint64_t seed);
+
+    int groups() const { return this->groups_; }
+    int liveCards() const { return Card::NUM_CARDS - this->dead_.size(); }
+
+    // Writes count deals to masks, groups() masks per deal, deal after deal.
+    void sample(uint64_t* masks, int count) { (this->*kernel_)(masks, count); }
+    void sampleScalar(uint64_t* masks, int count);
+    void sampleAvx2(uint64_t* masks, int count);
+    static bool hasAvx2();
+    bool usesAvx2() const { return this->kernel_ == &DealSampler::sampleAvx2; }
+
+private:
+    alignas(32) uint32_t state_[4][LANES];
+    CardSet dead_;
+    int groupSizes_[MAX_GROUPS];
+    int groups_;
+    void (DealSampler::*kernel_)(uint64_t*, int);
+
+    // Bits no lane may deal at the start of a deal.
+    uint64_t blocked() const { return ~(CardSet::fullDeck() - this->dead_).mask(); }
+
+    // Copies a block of LANES deals, stored group-major, out deal-major.
+    void storeBlock(const uint64_t* block, uint64_t* masks, int count) const;
+};
+
+#endif
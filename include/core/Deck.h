@@ -2,23 +2,46 @@
 #define DECK_H
 
 #include "Card.h"
+#include "CardSet.h"
+#include "FastRandom.h"
+#include <array>
+#include <cstdint>
 #include <vector>
-#include <memory>
 
+// Fixed 52-card deck shuffled lazily: each draw swaps a random undrawn card
+// into the next slot (one Fisher-Yates step), so a hand pays only for the
+// cards it deals. The array always holds a permutation of the deck, and
+// Fisher-Yates is uniform from any starting order, so reset() just rewinds.
+// Dead cards are kept past the live end and never drawn.
 class Deck {
-    std::vector<Card> cards_;
+    std::array<Card, Card::NUM_CARDS> cards_;
+    int live_;
+    int drawn_;
+    CardSet dead_;
+    FastRandom rng_;
 
 public:
     Deck();
-    void shuffle();
-    Card draw();
-    void reset();
-    bool isEmpty() { return cards_.empty(); }
-    std::vector<Card>& getRemainingCards() { return cards_; }
-    std::vector<Card> getRemainingCardsCopy() { return cards_; }
-};
+    explicit Deck(uint64_t seed);
+    // Draws come from this seed's sequence from here on.
+    void seed(uint64_t seed) { rng_.seed(seed); }
 
-#endif
+    // Returns every card to the deck, clearing any dead cards.
+    void reset() { this->reset(CardSet()); }
+    // Returns every card not in dead to the deck; dead cards stay out until
+    // the next reset.
+    void reset(CardSet dead);
 
+    // Callers check isEmpty() first: an empty deck gives Card(), which is
+    // no card (isValid() is false), never a copy of a dealt one.
+    Card draw();
+    // Draws up to count cards into out; returns how many were drawn.
+    int drawN(Card* out, int count);
 
+    bool isEmpty() const { return drawn_ == live_; }
+    int size() const { return live_ - drawn_; }
+    CardSet getRemainingSet() const;
+    std::vector<Card> getRemainingCards() const;
+};
 
+#endif
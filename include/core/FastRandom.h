@@ -0,0 +1,64 @@
+#ifndef FASTRANDOM_H
+#define FASTRANDOM_H
+
+#include <cstdint>
+
+// xoshiro256** generator seeded through splitmix64. 32 bytes of state and a
+// handful of instructions per draw; used wherever we sample in hot loops.
+// One seed fans out into independent streams through streamSeed(), so a
+// table, its deck and each of its bots draw from separate sequences that
+// all replay exactly from that seed.
+class FastRandom {
+    uint64_t state_[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    explicit FastRandom(uint64_t seed = 0x9E3779B97F4A7C15ull) { this->seed(seed); }
+
+    void seed(uint64_t seed) {
+        for (int i = 0; i < 4; ++i) {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            state_[i] = z ^ (z >> 31);
+        }
+    }
+
+    // Seed of the given stream under a parent seed: the two are mixed
+    // through the splitmix64 finalizer, so neighbouring stream numbers give
+    // unrelated seeds.
+    static uint64_t streamSeed(uint64_t seed, uint64_t stream) {
+        uint64_t z = seed ^ (stream + 1) * 0xD1B54A32D192ED03ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t next() {
+        uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    uint32_t nextBelow(uint32_t bound) {
+        return static_cast<uint32_t>(((next() >> 32) * bound) >> 32);
+    }
+
+    float nextFloat() {
+        return (next() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    float nextFloat(float low, float high) {
+        return low + (high - low) * nextFloat();
+    }
+};
+
+#endif
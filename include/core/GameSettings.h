@@ -1,6 +1,9 @@
 #ifndef GAMESETTINGS_H
 #define GAMESETTINGS_H
 
+#include <cstdint>
+#include <vector>
+
 struct GameSettings {
     int difficulty = 5;
     int numBots = 3;
@@ -8,9 +11,17 @@ struct GameSettings {
     bool calculateWinChance = true;
     bool showOuts = true;
     bool showAllHandsAtEnd = true;
+    bool humanPlayer = true;
+    // Difficulty of each bot in seat order; bots past the end use difficulty.
+    std::vector<int> botDifficulties;
     
     int startingBalance = 1000;
     int smallBlind = 10;
+    
+    // Seeds the deck, the bots, tie-breaks and Monte Carlo equities; the
+    // same seed replays a game exactly. 0 picks one from the clock when the
+    // game is created.
+    uint64_t seed = 0;
 };
 
 #endif
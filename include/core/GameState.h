@@ -2,13 +2,13 @@
 #define GAMESTATE_H
 
 #include "Card.h"
+#include "CardSet.h"
+#include "SeatTable.h"
 #include "../interfaces/IHandEvaluator.h"
 #include <vector>
 #include <memory>
 #include <optional>
 
-class IPlayer;
-
 enum {
     ACTION_FOLD = 0,
     ACTION_CHECK = 1,
@@ -23,12 +23,15 @@ struct GameState {
     int currentBet = 0;
     int smallBlind = 10;
     std::vector<Card> communityCards;
-    std::vector<std::shared_ptr<IPlayer>> players;
+    CardSet communitySet;
+    SeatTable seats;
     int dealerPosition = 0;
     int currentPlayerIndex = 0;
     
     std::optional<float> winChance;
-    std::optional<std::vector<Card>> outs;
+    std::optional<std::vector<OutsGroup>> outs;
+    std::optional<TrueOuts> trueOuts;
+    std::optional<std::vector<DrawOdds>> drawOdds;
     
     std::shared_ptr<IHandEvaluator> evaluator = nullptr;
 };
@@ -0,0 +1,30 @@
+#ifndef SEATTABLE_H
+#define SEATTABLE_H
+
+#include "Card.h"
+#include "CardSet.h"
+#include <cstdint>
+#include <string>
+
+// Chips, bets, fold flags and hole cards of every seat, one fixed-size array
+// per field. The engine owns the table and walks it seat by seat on every
+// action; balances and bets of all MAX_SEATS seats share one cache line, so
+// those walks never leave it. Players read the table through GameState and
+// never own a copy of these fields.
+struct SeatTable {
+    static const int MAX_SEATS = 8;
+
+    alignas(64) int32_t balance[MAX_SEATS] = {};
+    int32_t currentBet[MAX_SEATS] = {};
+    CardSet hand[MAX_SEATS];
+    bool active[MAX_SEATS] = {};
+    int count = 0;
+    std::string names[MAX_SEATS];
+
+    // Not folded and dealt in, so still contesting the pot.
+    bool inHand(int seat) const { return this->active[seat] && this->hand[seat].size() == 2; }
+    // Not folded and with chips behind, so still to act.
+    bool canAct(int seat) const { return this->active[seat] && this->balance[seat] > 0; }
+};
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Process-wide work-stealing pool. Each worker owns a deque: it pops its own
+// tasks from the back and steals from the front of the others when idle.
+// parallelFor blocks until every index has run; the calling thread helps,
+// so nested calls from inside a task cannot deadlock. The first exception a
+// task throws is rethrown by parallelFor once every index has finished.
+class ThreadPool {
+    struct Batch {
+        const std::function<void(int)>* body;
+        std::atomic<int> remaining;
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+    struct Task {
+        Batch* batch;
+        int index;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> threads_;
+    std::atomic<int> pending_;
+    std::atomic<bool> stopping_;
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+
+    bool popTask(size_t self, Task& task);
+    bool runOne(size_t self);
+    void workerLoop(size_t self);
+
+public:
+    explicit ThreadPool(unsigned numThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    static ThreadPool& instance();
+
+    // Worker threads plus the calling thread.
+    unsigned size() const { return static_cast<unsigned>(threads_.size()) + 1; }
+
+    void parallelFor(int count, const std::function<void(int)>& body);
+};
+
+#endif
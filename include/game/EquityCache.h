@@ -0,0 +1,98 @@
+#ifndef EQUITYCACHE_H
+#define EQUITYCACHE_H
+
+#include "../core/CardSet.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Thread-safe LRU cache of equities keyed by hole cards, board and opponent
+// count. Hole cards and board are reduced to their HandIndexer index, so
+// AhKh on a spade board and AsKs on a heart board share an entry. Entries
+// are split across independently locked shards, each evicting its least
+// recently used entry once full. The contents can be saved to and restored
+// from a file.
+class EquityCache {
+public:
+    static const size_t DEFAULT_CAPACITY = 1 << 16;
+    static const int NUM_SHARDS = 16;
+    static const uint32_t FILE_MAGIC = 0x48435145;  // "EQCH"
+    static const uint32_t FILE_VERSION = 2;
+
+    struct Key {
+        uint64_t index;
+        uint32_t boardCards;
+        uint32_t opponents;
+
+        bool operator==(const Key& other) const {
+            return index == other.index && boardCards == other.boardCards && opponents == other.opponents;
+        }
+    };
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t count;
+    };
+
+    struct FileRecord {
+        uint64_t index;
+        uint32_t boardCards;
+        uint32_t opponents;
+        float equity;
+    };
+
+    static Key canonicalKey(CardSet hand, CardSet board, int opponents);
+
+    explicit EquityCache(size_t capacity = DEFAULT_CAPACITY);
+    EquityCache(const EquityCache&) = delete;
+    EquityCache& operator=(const EquityCache&) = delete;
+
+    bool find(const Key& key, float& equity);
+    void insert(const Key& key, float equity);
+    void clear();
+
+    size_t size() const;
+    size_t capacity() const { return this->shardCapacity_ * NUM_SHARDS; }
+    uint64_t hits() const { return this->hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return this->misses_.load(std::memory_order_relaxed); }
+    uint64_t evictions() const { return this->evictions_.load(std::memory_order_relaxed); }
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            uint64_t h = key.index * 0x9E3779B97F4A7C15ull;
+            h ^= (static_cast<uint64_t>(key.boardCards) << 32 | key.opponents) * 0xC2B2AE3D27D4EB4Full;
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+    };
+
+    using Entry = std::pair<Key, float>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> order;
+        std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    };
+
+    size_t shardCapacity_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+    std::atomic<uint64_t> hits_;
+    std::atomic<uint64_t> misses_;
+    std::atomic<uint64_t> evictions_;
+
+    Shard& shardFor(const Key& key) const {
+        return *this->shards_[(KeyHash()(key) >> 7) % NUM_SHARDS];
+    }
+};
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef EQUITYENGINE_H
+#define EQUITYENGINE_H
+
+#include "../core/Card.h"
+#include "../core/CardSet.h"
+#include "../core/FastRandom.h"
+#include "../interfaces/IHandEvaluator.h"
+#include "HandTables.h"
+#include "IncrementalEvaluator.h"
+#include <cstdint>
+
+// All-in equity. Heads-up post-flop spots are enumerated exactly over every
+// runout and opponent holding; everything else is Monte Carlo sampled until
+// the budget's standard error, sample or time limit is reached. Both paths
+// are split into chunks on the shared ThreadPool; after seed() the result
+// is reproducible as long as the time limit is not what stops sampling.
+// Hands are scored through HandTables::evaluateBatch.
+class EquityEngine {
+    const HandTables& tables;
+    FastRandom rng;
+
+    void enumerateRunout(int heroValue, CardSet board, CardSet live, double& equity, int64_t& deals) const;
+    void enumerateBoards(const uint64_t* cards, int count, int remaining, uint64_t firstPrefix, uint64_t prefixes,
+                         CardSet hero, CardSet villain, double& equity, int64_t& deals) const;
+    void sampleChunk(int missing, int numOpponents, CardSet hand, CardSet board, uint64_t seed, int samples,
+                     double& sum, double& sumSquares) const;
+
+public:
+    static const int CHECK_INTERVAL = 256;
+    static const int ROUND_CHUNKS = 32;
+    static const int SAMPLE_BATCH = 64;
+    static const int MAX_OPPONENTS = 9;
+    static const int MAX_HOLDINGS = 1081;
+
+    EquityEngine();
+
+    void seed(uint64_t seed) { this->rng.seed(seed); }
+
+    EquityResult calculate(CardSet hand, CardSet board, int numOpponents, EquityBudget budget);
+    EquityResult exactEquity(CardSet hand, CardSet board);
+    EquityResult handVsHand(CardSet hero, CardSet villain, CardSet board);
+    EquityResult monteCarloEquity(CardSet hand, CardSet board, int numOpponents, EquityBudget budget);
+};
+
+#endif
@@ -3,71 +3,114 @@
 
 #include "../interfaces/IHandEvaluator.h"
 #include "../core/Card.h"
+#include "../core/CardSet.h"
+#include "EquityCache.h"
+#include "EquityEngine.h"
+#include "HeadsUpMatrix.h"
+#include "IncrementalEvaluator.h"
+#include "RiverTable.h"
+#include <memory>
+#include <string>
 #include <vector>
-#include <unordered_map>
 
+// Hand categories; HandTables::category() maps a hand rank to one.
 enum {
-    HAND_ROYAL_FLUSH = 9000000,
-    HAND_STRAIGHT_FLUSH = 8000000,
-    HAND_FOUR_OF_A_KIND = 7000000,
-    HAND_FULL_HOUSE = 6000000,
-    HAND_FLUSH = 5000000,
-    HAND_STRAIGHT = 4000000,
-    HAND_THREE_OF_A_KIND = 3000000,
-    HAND_TWO_PAIR = 2000000,
-    HAND_ONE_PAIR = 1000000,
+    HAND_ROYAL_FLUSH = 9,
+    HAND_STRAIGHT_FLUSH = 8,
+    HAND_FOUR_OF_A_KIND = 7,
+    HAND_FULL_HOUSE = 6,
+    HAND_FLUSH = 5,
+    HAND_STRAIGHT = 4,
+    HAND_THREE_OF_A_KIND = 3,
+    HAND_TWO_PAIR = 2,
+    HAND_ONE_PAIR = 1,
     HAND_HIGH_CARD = 0
 };
 
+static const int HAND_CATEGORIES = 10;
+
 class HandEvaluator : public IHandEvaluator {
 private:
-    std::vector<Card> getBestFiveCards(std::vector<Card>& cards);
-    bool isRoyalFlush(std::vector<Card>& cards);
-    bool isStraightFlush(std::vector<Card>& cards);
-    bool isFourOfAKind(std::vector<Card>& cards);
-    bool isFullHouse(std::vector<Card>& cards);
-    bool isFlush(std::vector<Card>& cards);
-    bool isStraight(std::vector<Card>& cards);
-    bool isThreeOfAKind(std::vector<Card>& cards);
-    bool isTwoPair(std::vector<Card>& cards);
-    bool isOnePair(std::vector<Card>& cards);
-    int getHandValue(std::vector<Card>& cards);
-    float calculateEquityPreFlop(std::vector<Card>& playerHand, int numOpponents);
-    float calculateEquityPostFlop(std::vector<Card>& playerHand, 
-                                  std::vector<Card>& communityCards, 
-                                  int numOpponents);
-    float calculateEquityPostTurn(std::vector<Card>& playerHand,
-                                  std::vector<Card>& communityCards,
-                                  int numOpponents);
-    void generateCombinations(std::vector<Card>& availableCards, 
-                             int k, 
-                             std::vector<std::vector<Card>>& result,
-                             std::vector<Card>& current,
-                             int start);
-    bool improvesToHandType(std::vector<Card>& hand,
-                           std::vector<Card>& community,
-                           Card testCard,
-                           int targetHandType);
-    std::vector<Card> getAvailableCards(std::vector<Card>& hand,
-                                       std::vector<Card>& community,
-                                       std::vector<std::vector<Card>> opponentHands);
+    EquityEngine equityEngine;
+    EquityCache equityCache;
+    HeadsUpMatrix headsUpMatrix;
+    bool persistent;
+
+    CardSet cachedCards;
+    int cachedValue = -1;
+
+    std::unique_ptr<RiverTable> riverTable;
+
+    CardSet drawOddsCards;
+    CardSet drawOddsDead;
+    std::vector<DrawOdds> drawOdds;
+
+    int currentHandValue(CardSet cards);
 
 public:
-    int evaluateHand(std::vector<Card>& hand) override;
+    static constexpr const char* HEADS_UP_MATRIX_PATH = "data/headsup_equity.bin";
+    static constexpr const char* EQUITY_CACHE_PATH = "data/equity_cache.bin";
+
+    // A persistent evaluator maps the heads-up matrix and loads the equity
+    // cache from data/, saving the cache back when destroyed. Evaluators for
+    // simulated tables, many at once, leave both files alone.
+    explicit HandEvaluator(bool persistent = true);
+    ~HandEvaluator();
+
+    const EquityCache& getEquityCache() const { return this->equityCache; }
+    // Built on first use for a board and kept until the board changes.
+    const RiverTable& getRiverTable(CardSet board);
+
+    bool loadHeadsUpMatrix(const std::string& path);
+    bool hasHeadsUpMatrix() const { return this->headsUpMatrix.isLoaded(); }
+    // Preflop all-in equity from the heads-up matrix, so all five board
+    // cards are still to come. Range combos sharing a card with the hand
+    // or the dead cards, such as folded or exposed ones, are dropped; a
+    // hand with a repeated card or a dead one gets 0.
+    float handVsRangeEquity(const std::vector<Card>& hand, const std::vector<float>& villainRange,
+                            const std::vector<Card>& deadCards = {});
+    float rangeVsRangeEquity(const std::vector<float>& heroRange, const std::vector<float>& villainRange);
+
+    void seed(uint64_t seed) override { this->equityEngine.seed(seed); }
+    int evaluateHand(const std::vector<Card>& hand) const override;
+    int evaluateHand(CardSet cards) const override;
+    void evaluateBatch(const CardSet* hands, int32_t* ranks, size_t count) const override;
     float calculateWinProbability(
-        std::vector<Card>& playerHand,
-        std::vector<Card>& communityCards,
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards,
         int numOpponents
     ) override;
+    EquityResult calculateEquity(
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards,
+        int numOpponents,
+        EquityBudget budget
+    ) override;
+    std::vector<OutsGroup> findOutsByCategory(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) override;
+    TrueOuts findTrueOuts(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) override;
+    std::vector<DrawOdds> calculateDrawOdds(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) override;
     std::vector<Card> findOuts(
-        std::vector<Card>& hand,
-        std::vector<Card>& community,
-        std::vector<std::vector<Card>>& opponentHands
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
     ) override;
     int evaluateBestHand(
-        std::vector<Card>& playerHand,
-        std::vector<Card>& communityCards
-    ) override;
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards
+    ) const override;
+    int evaluateBestHand(CardSet playerHand, CardSet communityCards) const override;
 };
 
 #endif
@@ -0,0 +1,51 @@
+#ifndef HANDINDEXER_H
+#define HANDINDEXER_H
+
+#include "../core/CardSet.h"
+#include <cstdint>
+#include <vector>
+
+// Dense index of (hole cards, board) pairs up to suit relabelling: every
+// isomorphism class of a fixed-size hole and board gets one index in
+// [0, size()). With no board the two hole cards give the 169 preflop
+// classes; three board cards and no hole give the 1,755 distinct flops.
+//
+// Each suit's cards are described by its shape (how many hole and board
+// cards it holds) and a colex rank of its rank sets. Suits are sorted by
+// shape and rank; the sorted shapes pick a block of indices, and suits of
+// equal shape are ranked as a multiset inside it, so the index does not
+// depend on which concrete suit held what.
+class HandIndexer {
+public:
+    static const int MAX_HOLE_CARDS = 2;
+    static const int MAX_BOARD_CARDS = 5;
+
+    HandIndexer(int holeCards, int boardCards);
+
+    static const HandIndexer& instance(int holeCards, int boardCards);
+
+    int holeCards() const { return this->holeCards_; }
+    int boardCards() const { return this->boardCards_; }
+    uint64_t size() const { return this->size_; }
+
+    // hole and board must hold holeCards() and boardCards() cards.
+    uint64_t index(CardSet hole, CardSet board) const;
+    // Canonical representative of an index; index() maps it back.
+    void unindex(uint64_t index, CardSet& hole, CardSet& board) const;
+
+private:
+    struct Configuration {
+        uint32_t key;
+        uint64_t offset;
+        uint64_t multipliers[4];  // place value of the suit group starting at each position
+    };
+
+    int holeCards_;
+    int boardCards_;
+    uint64_t size_;
+    std::vector<Configuration> configurations_;
+
+    void addConfigurations(int suit, int shapes[4], int holeLeft, int boardLeft);
+};
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef HANDTABLES_H
+#define HANDTABLES_H
+
+#include "../core/CardSet.h"
+#include <cstdint>
+#include <vector>
+
+// Lookup tables for scoring 5-7 cards without enumerating 5-card subsets.
+// Cards are passed as four 13-bit rank masks, one per suit. Non-flush hands
+// are looked up by a base-5 rank-count key, flushes by the suit's rank mask.
+//
+// Scores are dense hand ranks: the 7462 distinct five-card hands numbered
+// from 1 (7-5-4-3-2 high) to 7462 (royal flush), so a stronger hand always
+// has a higher rank and every rank fits a uint16_t. 0 means fewer than five
+// cards. describe() decodes a rank into its category and ranks.
+class HandTables {
+public:
+    static const int RANK_MASK_SIZE = 1 << 13;
+    static const int HASH_BITS = 17;
+    static const int HASH_SIZE = 1 << HASH_BITS;
+    static const int NUM_HAND_RANKS = 7462;
+
+    // Category (a HAND_* value) and the ranks that decide ties within it,
+    // most significant first: the quad rank then the kicker, the trips then
+    // the pair, a straight's high card, and so on.
+    struct HandRankInfo {
+        uint8_t category;
+        uint8_t numRanks;
+        uint8_t ranks[5];
+    };
+
+    static const HandTables& instance();
+
+    const HandRankInfo& describe(int handRank) const { return handRankInfo_[handRank]; }
+    int category(int handRank) const { return handRankInfo_[handRank].category; }
+    // First hand rank of a category, and of the one above it.
+    static int firstRank(int category) { return CATEGORY_FIRST_RANK[category]; }
+    static int endRank(int category) { return CATEGORY_FIRST_RANK[category + 1]; }
+
+    uint32_t rankKey(int rankMask) const { return rankKeys_[rankMask]; }
+    int flushValue(int rankMask) const { return flushValues_[rankMask]; }
+    int rankCountValue(uint32_t key) const;
+    uint32_t cardKey(Card card) const { return rankKeys_[1 << (card.getRank() - RANK_TWO)]; }
+    int evaluate(uint32_t key, const int suitMasks[4]) const;
+    int evaluate(const int suitMasks[4]) const;
+    int evaluate(CardSet cards) const;
+
+    // Scores count card masks (CardSet::mask()) into values. Dispatches once,
+    // at construction, to the AVX2 gather kernel when the CPU has it.
+    void evaluateBatch(const uint64_t* masks, int32_t* values, int count) const {
+        (this->*batchKernel_)(masks, values, count);
+    }
+    void evaluateBatchScalar(const uint64_t* masks, int32_t* values, int count) const;
+    void evaluateBatchAvx2(const uint64_t* masks, int32_t* values, int count) const;
+    static bool hasAvx2();
+    bool usesAvx2() const { return batchKernel_ == &HandTables::evaluateBatchAvx2; }
+
+    static uint32_t hashSlot(uint32_t key) {
+        return (key * 2654435761u) >> (32 - HASH_BITS);
+    }
+    static int straightHigh(int rankMask);
+
+private:
+    static const int CATEGORY_FIRST_RANK[11];
+
+    // Value tables hold one spare slot so the AVX2 kernel's 32-bit gathers
+    // of 16-bit entries stay inside the allocation.
+    std::vector<uint32_t> rankKeys_;
+    std::vector<uint16_t> flushValues_;
+    std::vector<uint32_t> rankCountKeys_;
+    std::vector<uint16_t> rankCountValues_;
+    std::vector<HandRankInfo> handRankInfo_;
+    void (HandTables::*batchKernel_)(const uint64_t*, int32_t*, int) const;
+
+    HandTables();
+    void buildRankCountTable(int counts[13], int rank, int total, std::vector<int>& sortKeys);
+    static int scoreFlush(int rankMask);
+    static int scoreRankCounts(const int counts[13]);
+};
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef HEADSUPMATRIX_H
+#define HEADSUPMATRIX_H
+
+#include "../core/Card.h"
+#include "../core/CardSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Exact heads-up preflop all-in equity of every hole-card combo against every
+// other, memory-mapped from the file written by
+// tools/HeadsUpMatrixGenerator.cpp. Combos are indexed by colex rank of their
+// two card indices; entry [i][j] is combo i's fixed-point equity (0-65535)
+// against combo j, and 0 where the two combos share a card.
+class HeadsUpMatrix {
+public:
+    static const int NUM_COMBOS = 1326;
+    static const int EQUITY_SCALE = 65535;
+    static const uint32_t FILE_MAGIC = 0x51455548;  // "HUEQ"
+    static const uint32_t FILE_VERSION = 1;
+
+    struct FileHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t numCombos;
+        uint32_t scale;
+    };
+
+    static constexpr int comboIndex(int firstIndex, int secondIndex) {
+        return firstIndex > secondIndex ? firstIndex * (firstIndex - 1) / 2 + secondIndex
+                                        : secondIndex * (secondIndex - 1) / 2 + firstIndex;
+    }
+    static constexpr int comboIndex(Card first, Card second) {
+        return comboIndex(first.getIndex(), second.getIndex());
+    }
+    static CardSet comboCards(int combo);
+
+    HeadsUpMatrix() = default;
+    HeadsUpMatrix(const HeadsUpMatrix&) = delete;
+    HeadsUpMatrix& operator=(const HeadsUpMatrix&) = delete;
+    ~HeadsUpMatrix();
+
+    bool load(const std::string& path);
+    void unload();
+    bool isLoaded() const { return values_ != nullptr; }
+
+    const uint16_t* row(int combo) const { return values_ + static_cast<size_t>(combo) * NUM_COMBOS; }
+    float equity(int heroCombo, int villainCombo) const {
+        return row(heroCombo)[villainCombo] / static_cast<float>(EQUITY_SCALE);
+    }
+
+    float comboVsRange(int heroCombo, const std::vector<float>& villainWeights) const;
+    float rangeVsRange(const std::vector<float>& heroWeights, const std::vector<float>& villainWeights) const;
+
+private:
+    void* mapping_ = nullptr;
+    size_t mappingSize_ = 0;
+    const uint16_t* values_ = nullptr;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef INCREMENTALEVALUATOR_H
+#define INCREMENTALEVALUATOR_H
+
+#include "../core/Card.h"
+#include "../core/CardSet.h"
+#include "HandTables.h"
+#include <cstdint>
+
+// Hole cards plus board kept as a running rank-count key, per-suit rank
+// masks and the card mask, so enumeration can add a street's card with
+// push(), score with value() and step back with pop(), all in O(1).
+class IncrementalEvaluator {
+public:
+    static const int MAX_CARDS = 7;
+
+private:
+    const HandTables& tables_;
+    uint32_t key_;
+    int suitMasks_[4];
+    CardSet cards_;
+    Card stack_[MAX_CARDS];
+    int size_;
+
+public:
+    IncrementalEvaluator() : tables_(HandTables::instance()), key_(0), suitMasks_{0, 0, 0, 0}, size_(0) {}
+    explicit IncrementalEvaluator(CardSet cards) : IncrementalEvaluator() {
+        for (Card card : cards) {
+            this->push(card);
+        }
+    }
+
+    void push(Card card) {
+        this->key_ += this->tables_.cardKey(card);
+        this->suitMasks_[card.getSuit()] |= 1 << (card.getRank() - RANK_TWO);
+        this->cards_.insert(card);
+        this->stack_[this->size_++] = card;
+    }
+
+    void pop() {
+        Card card = this->stack_[--this->size_];
+        this->key_ -= this->tables_.cardKey(card);
+        this->suitMasks_[card.getSuit()] &= ~(1 << (card.getRank() - RANK_TWO));
+        this->cards_.remove(card);
+    }
+
+    int value() const { return this->tables_.evaluate(this->key_, this->suitMasks_); }
+    // Value with one more card, without changing the state.
+    int valueWith(Card card) const {
+        int suitMasks[4] = {this->suitMasks_[0], this->suitMasks_[1], this->suitMasks_[2], this->suitMasks_[3]};
+        suitMasks[card.getSuit()] |= 1 << (card.getRank() - RANK_TWO);
+        return this->tables_.evaluate(this->key_ + this->tables_.cardKey(card), suitMasks);
+    }
+
+    int size() const { return this->size_; }
+    CardSet cards() const { return this->cards_; }
+    uint32_t key() const { return this->key_; }
+    int suitMask(int suit) const { return this->suitMasks_[suit]; }
+};
+
+#endif
@@ -4,46 +4,84 @@
 #include "../core/GameSettings.h"
 #include "../core/GameState.h"
 #include "../core/Deck.h"
+#include "../core/FastRandom.h"
 #include "../interfaces/IPlayer.h"
 #include "../interfaces/IGameView.h"
 #include "../interfaces/IHandEvaluator.h"
 #include "../game/HandEvaluator.h"
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <memory>
 
+// Outcome of a headless run: chips each seat won or lost over all hands,
+// and for tournaments how many each seat won outright.
+struct SimulationResult {
+    int hands = 0;
+    int tournaments = 0;
+    double seconds = 0.0;
+    std::vector<std::string> names;
+    std::vector<int64_t> netChips;
+    std::vector<int> tournamentWins;
+};
+
 class PokerGame {
+    static const int TOURNAMENT_LEVEL_HANDS = 100;
+    // Streams split from settings.seed; bot i, numbered from 1, draws from
+    // STREAM_BOTS + i, and the evaluator's equity sampling from the stream
+    // after the one a full table of bots ends on.
+    static const int STREAM_DECK = 0;
+    static const int STREAM_GAME = 1;
+    static const int STREAM_BOTS = 2;
+    static const int STREAM_EQUITY = STREAM_BOTS + SeatTable::MAX_SEATS + 1;
+    
     GameSettings settings;
+    // Decision policy of each seat; chips, bets and cards are in state.seats.
     std::vector<std::shared_ptr<IPlayer>> players;
     std::shared_ptr<IGameView> view;
     std::shared_ptr<IHandEvaluator> evaluator;
     std::unique_ptr<Deck> deck;
+    FastRandom rng;
     GameState state;
     
     bool gameRunning;
     
+    void seedStreams();
     void setupPlayers();
     void dealCards();
     void postBlinds();
     void bettingRound();
     void revealCommunityCards(int count);
+    void finishHand();
     void showdown();
     void determineWinner();
     void resetRound();
     int getNextActivePlayer(int startIndex) ;
     bool allPlayersActed() ;
-    void processAction(std::shared_ptr<IPlayer> player,  Action& action);
-    void processAction(std::shared_ptr<IPlayer> player,  Action& action, bool verbose);
+    void processAction(int seat,  Action& action);
+    void processAction(int seat,  Action& action, bool verbose);
     void updateGameState();
+    int playersWithChips();
+    void beginSimulation(SimulationResult& result);
+    void playSimulatedRound(SimulationResult& result);
 
 public:
     PokerGame(std::shared_ptr<IGameView> view);
     PokerGame(std::shared_ptr<IGameView> view,  GameSettings& settings);
+    PokerGame(std::shared_ptr<IGameView> view,  GameSettings& settings, std::shared_ptr<IHandEvaluator> evaluator);
     
     void initialize();
     void startGame();
     void playRound();
     void run();
     
+    // Bot-only play with no view and no prompts. simulate() plays a number
+    // of hands, topping busted seats back up to the starting balance;
+    // simulateTournaments() plays each tournament until one seat holds
+    // every chip, doubling the blinds every TOURNAMENT_LEVEL_HANDS hands.
+    SimulationResult simulate(int hands);
+    SimulationResult simulateTournaments(int tournaments);
+    
     GameSettings& getSettings() { return settings; }
  GameState& getState()  { return state; }
 };
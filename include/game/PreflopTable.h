@@ -0,0 +1,35 @@
+#ifndef PREFLOPTABLE_H
+#define PREFLOPTABLE_H
+
+#include "../core/Card.h"
+#include <cstdint>
+
+// All-in preflop equity of the 169 starting-hand classes against 1-9 random
+// opponents. Classes are laid out as a 13x13 grid: pairs on the diagonal,
+// suited hands at [high][low], offsuit hands at [low][high]. Values are
+// fixed-point equity (0-65535) produced by tools/PreflopTableGenerator.cpp.
+class PreflopTable {
+public:
+    static const int NUM_CLASSES = 169;
+    static const int MAX_OPPONENTS = 9;
+    static const int EQUITY_SCALE = 65535;
+
+    static constexpr int classIndex(int highRank, int lowRank, bool suited) {
+        return suited ? (highRank - RANK_TWO) * 13 + (lowRank - RANK_TWO)
+                      : (lowRank - RANK_TWO) * 13 + (highRank - RANK_TWO);
+    }
+    static constexpr int classIndex(Card first, Card second) {
+        return first.getRank() >= second.getRank()
+                   ? classIndex(first.getRank(), second.getRank(), first.getSuit() == second.getSuit())
+                   : classIndex(second.getRank(), first.getRank(), first.getSuit() == second.getSuit());
+    }
+
+    static float equity(int classIndex, int numOpponents);
+    static float equity(Card first, Card second, int numOpponents) {
+        return equity(classIndex(first, second), numOpponents);
+    }
+};
+
+extern const uint16_t PREFLOP_EQUITY[PreflopTable::NUM_CLASSES][PreflopTable::MAX_OPPONENTS];
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef RIVERTABLE_H
+#define RIVERTABLE_H
+
+#include "../core/Card.h"
+#include "../core/CardSet.h"
+#include <cstdint>
+#include <vector>
+
+// Every two-card holding on a complete board, scored once and swept in rank
+// order, so the showdown odds of any holding against a random one are known
+// with its own cards removed from the opponent's holdings. Holdings are
+// indexed by colex rank of their two card indices, as in HeadsUpMatrix.
+class RiverTable {
+public:
+    static const int NUM_HOLDINGS = 1326;
+    // Opponents whose holdings equity() counts exactly.
+    static const int MAX_OPPONENTS = 3;
+
+    explicit RiverTable(CardSet board);
+
+    CardSet board() const { return this->board_; }
+    int handRank(CardSet hand) const { return this->ranks_[holdingIndex(hand)]; }
+
+    // Chance of beating, and of tying, one random holding of the unseen cards.
+    float winShare(CardSet hand) const { return this->wins_[holdingIndex(hand)]; }
+    float tieShare(CardSet hand) const { return this->ties_[holdingIndex(hand)]; }
+
+    // Exact equity against up to MAX_OPPONENTS random holdings, each dealt
+    // from the cards the others leave; 0 for more opponents.
+    float equity(CardSet hand, int numOpponents) const;
+
+private:
+    CardSet board_;
+    std::vector<uint16_t> ranks_;
+    std::vector<float> wins_;
+    std::vector<float> ties_;
+
+    static int holdingIndex(CardSet hand);
+};
+
+#endif
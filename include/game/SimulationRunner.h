@@ -0,0 +1,57 @@
+#ifndef SIMULATIONRUNNER_H
+#define SIMULATIONRUNNER_H
+
+#include "../core/GameSettings.h"
+#include <cstdint>
+#include <vector>
+
+// One bot of the lineup over a whole batch. Errors are the half-width of a
+// 95% confidence interval.
+struct BotSummary {
+    int difficulty = 0;
+    int64_t netChips = 0;
+    double bbPer100 = 0.0;
+    double bbPer100Error = 0.0;
+    int tournamentWins = 0;
+    double winRate = 0.0;
+    double winRateError = 0.0;
+};
+
+struct BatchResult {
+    uint64_t seed = 0;
+    int tables = 0;
+    int64_t hands = 0;
+    int tournaments = 0;
+    double seconds = 0.0;
+    std::vector<BotSummary> bots;
+};
+
+// Independent bot-only tables played in parallel on the shared ThreadPool.
+// Every table owns its game, deck, players and evaluator and writes its
+// totals only into its own slot, so tables share nothing mutable and take
+// no locks; the slots are merged once all tables are done.
+//
+// Table t is seeded with stream t of settings.seed (taken from the clock
+// if 0), so a batch replays exactly from its seed however the tables are
+// spread over threads.
+//
+// The lineup is settings.botDifficulties, cut to SeatTable::MAX_SEATS
+// bots. Each table seats it rotated by
+// the table number, so every bot plays every seat equally often. Cash
+// results are reported in big blinds per 100 hands, with the interval
+// taken from the spread between tables (batch means).
+class SimulationRunner {
+    GameSettings settings;
+
+    BatchResult run(int tables, int tableHands, int64_t lastTableHands, bool tournaments);
+
+public:
+    static const int DEFAULT_TABLE_HANDS = 10000;
+
+    explicit SimulationRunner(const GameSettings& settings);
+
+    BatchResult runHands(int64_t hands, int tableHands = DEFAULT_TABLE_HANDS);
+    BatchResult runTournaments(int tournaments);
+};
+
+#endif
@@ -2,27 +2,100 @@
 #define IHANDEVALUATOR_H
 
 #include "../core/Card.h"
+#include "../core/CardSet.h"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
+struct EquityBudget {
+    int minSamples = 2000;
+    int maxSamples = 500000;
+    double maxMillis = 25.0;
+    double targetStandardError = 0.0025;
+};
+
+struct EquityResult {
+    float equity = 0.0f;
+    float standardError = 0.0f;
+    float confidenceLow = 0.0f;
+    float confidenceHigh = 0.0f;
+    int64_t samples = 0;
+    bool exact = false;
+};
+
+// Outs that lift the hand to one category (a HAND_* value), in deck order.
+struct OutsGroup {
+    int handType = 0;
+    std::vector<Card> cards;
+};
+
+// Cards that take us from behind to ahead of (winning) or level with
+// (tying) the best of the known opponent hands.
+struct TrueOuts {
+    std::vector<Card> winning;
+    std::vector<Card> tying;
+};
+
+// Chance of finishing the hand in one category (a HAND_* value) or a
+// better one, over every turn/river runout still to come. runnerRunner
+// covers the runouts where neither card alone gets there.
+struct DrawOdds {
+    int handType = 0;
+    double nextCard = 0.0;
+    double byRiver = 0.0;
+    double runnerRunner = 0.0;
+};
+
+// Hands are scored as dense ranks from 1 (weakest) to 7462 (royal flush),
+// 0 for fewer than five cards. Hands may be passed as card vectors or as
+// CardSet masks; the CardSet overloads and evaluateBatch never allocate.
+// evaluateBatch scores count 5-7 card hands into ranks behind a single
+// virtual call.
 class IHandEvaluator {
 public:
     virtual ~IHandEvaluator() = default;
-    virtual int evaluateHand(std::vector<Card>& hand) = 0;
+    // Seeds any sampling behind the equity calls, so a seeded game replays
+    // the same equities.
+    virtual void seed(uint64_t seed) = 0;
+    virtual int evaluateHand(const std::vector<Card>& hand) const = 0;
+    virtual int evaluateHand(CardSet cards) const = 0;
+    virtual void evaluateBatch(const CardSet* hands, int32_t* ranks, size_t count) const = 0;
     virtual float calculateWinProbability(
-        std::vector<Card>& playerHand,
-        std::vector<Card>& communityCards,
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards,
         int numOpponents
     ) = 0;
+    virtual EquityResult calculateEquity(
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards,
+        int numOpponents,
+        EquityBudget budget
+    ) = 0;
+    virtual std::vector<OutsGroup> findOutsByCategory(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) = 0;
+    virtual TrueOuts findTrueOuts(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) = 0;
+    virtual std::vector<DrawOdds> calculateDrawOdds(
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
+    ) = 0;
     virtual std::vector<Card> findOuts(
-        std::vector<Card>& hand,
-        std::vector<Card>& community,
-        std::vector<std::vector<Card>>& opponentHands
+        const std::vector<Card>& hand,
+        const std::vector<Card>& community,
+        const std::vector<std::vector<Card>>& opponentHands
     ) = 0;
     virtual int evaluateBestHand(
-        std::vector<Card>& playerHand,
-        std::vector<Card>& communityCards
-    ) = 0;
+        const std::vector<Card>& playerHand,
+        const std::vector<Card>& communityCards
+    ) const = 0;
+    virtual int evaluateBestHand(CardSet playerHand, CardSet communityCards) const = 0;
 };
 
 #endif
-
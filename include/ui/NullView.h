@@ -0,0 +1,29 @@
+#ifndef NULLVIEW_H
+#define NULLVIEW_H
+
+#include "../interfaces/IGameView.h"
+#include "../core/GameSettings.h"
+
+// View that shows nothing and never waits, for bot-only games run without
+// a terminal. Menus pick their first option; the pre-game screen keeps the
+// balance and blind it is handed.
+class NullView : public IGameView {
+public:
+    void displayMenu(std::vector<std::string> /*options*/) override {}
+    void displayGameState(GameState& /*state*/) override {}
+    void displayMessage(std::string /*message*/) override {}
+    void displayRules() override {}
+    
+    void clearScreen() override {}
+    void waitForInput() override {}
+    
+    int getMenuChoice(int min, int /*max*/) override { return min; }
+    int getIntInput(std::string /*prompt*/, int min = 0, int /*max*/ = 1000000) override { return min; }
+    std::string getStringInput(std::string /*prompt*/) override { return ""; }
+    
+    void displayPlayerActionMenu(GameState& /*state*/, int /*playerBalance*/, int /*minBet*/) override {}
+    void displaySettings(GameSettings& /*settings*/) override {}
+    void displayPreGameScreen(int& /*startingBalance*/, int& /*smallBlind*/) override {}
+};
+
+#endif
@@ -23,6 +23,7 @@ class TerminalView : public IGameView {
     void printSuit(int suit);
     std::string rankToString(int rank);
     std::string suitToSymbol(int suit);
+    std::string handTypeToString(int handType);
 
 public:
     TerminalView();
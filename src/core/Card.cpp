@@ -1,16 +1,18 @@
 #include "../../include/core/Card.h"
 
-Card::Card(int r, int s) : rank_(r), suit_(s) {}
-
-Card::Card() : rank_(RANK_TWO), suit_(SUIT_SPADES) {}
-
-std::string Card::toString() {
+std::string Card::toString() const {
+    if (!this->isValid()) {
+        return "??";
+    }
+    
     std::string result;
+    int rank = this->getRank();
+    int suit = this->getSuit();
     
-    if (rank_ >= RANK_TWO && rank_ <= RANK_TEN) {
-        result = std::to_string(rank_);
+    if (rank >= RANK_TWO && rank <= RANK_TEN) {
+        result = std::to_string(rank);
     } else {
-        switch (rank_) {
+        switch (rank) {
             case RANK_JACK:
                 result = "J";
                 break;
@@ -29,7 +31,7 @@ std::string Card::toString() {
         }
     }
     
-    switch (suit_) {
+    switch (suit) {
         case SUIT_SPADES:
             result += "♠";
             break;
@@ -49,21 +51,3 @@ std::string Card::toString() {
     
     return result;
 }
-
-bool Card::operator==(Card other) {
-    return rank_ == other.rank_ && suit_ == other.suit_;
-}
-
-bool Card::operator!=(Card other) {
-    return !(*this == other);
-}
-
-bool Card::operator<(Card other) {
-    if (rank_ != other.rank_) {
-        return rank_ < other.rank_;
-    }
-    return suit_ < other.suit_;
-}
-
-
-
@@ -0,0 +1,16 @@
+#include "../../include/core/CardSet.h"
+
+CardSet::CardSet(const std::vector<Card>& cards) : mask_(0) {
+    for (Card card : cards) {
+        this->insert(card);
+    }
+}
+
+std::vector<Card> CardSet::toCards() const {
+    std::vector<Card> cards;
+    cards.reserve(this->size());
+    for (Card card : *this) {
+        cards.push_back(card);
+    }
+    return cards;
+}
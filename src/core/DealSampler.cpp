@@ -0,0 +1,80 @@
+#include "../../include/core/DealSampler.h"
+#include "../../include/core/FastRandom.h"
+#include <algorithm>
+
+DealSampler::DealSampler(CardSet dead, const int* groupSizes, int groups, uint64_t seed)
+    : dead_(dead & CardSet::fullDeck()) {
+    this->groups_ = std::min(std::max(groups, 0), MAX_GROUPS);
+    int left = this->liveCards();
+    for (int g = 0; g < this->groups_; ++g) {
+        int size = groupSizes[g] <= left ? std::max(groupSizes[g], 0) : 0;
+        this->groupSizes_[g] = size;
+        left -= size;
+    }
+
+    for (int lane = 0; lane < LANES; ++lane) {
+        FastRandom laneRng(FastRandom::streamSeed(seed, lane));
+        uint64_t low = laneRng.next();
+        uint64_t high = laneRng.next();
+        this->state_[0][lane] = static_cast<uint32_t>(low);
+        this->state_[1][lane] = static_cast<uint32_t>(low >> 32);
+        this->state_[2][lane] = static_cast<uint32_t>(high);
+        this->state_[3][lane] = static_cast<uint32_t>(high >> 32) | 1;
+    }
+
+    this->kernel_ = hasAvx2() ? &DealSampler::sampleAvx2 : &DealSampler::sampleScalar;
+}
+
+void DealSampler::storeBlock(const uint64_t* block, uint64_t* masks, int count) const {
+    for (int lane = 0; lane < count; ++lane) {
+        for (int g = 0; g < this->groups_; ++g) {
+            masks[lane * this->groups_ + g] = block[g * LANES + lane];
+        }
+    }
+}
+
+static uint32_t rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+void DealSampler::sampleScalar(uint64_t* masks, int count) {
+    uint64_t block[MAX_GROUPS * LANES];
+    for (int done = 0; done < count; done += LANES) {
+        uint64_t used[LANES];
+        std::fill(used, used + LANES, this->blocked());
+        for (int g = 0; g < this->groups_; ++g) {
+            uint64_t* group = block + g * LANES;
+            std::fill(group, group + LANES, 0);
+            for (int card = 0; card < this->groupSizes_[g]; ++card) {
+                int need = (1 << LANES) - 1;
+                while (need) {
+                    // Every lane's generator steps each round, as in the
+                    // AVX2 kernel, whether or not the lane still needs a card.
+                    for (int lane = 0; lane < LANES; ++lane) {
+                        uint32_t& s0 = this->state_[0][lane];
+                        uint32_t& s1 = this->state_[1][lane];
+                        uint32_t& s2 = this->state_[2][lane];
+                        uint32_t& s3 = this->state_[3][lane];
+                        uint32_t value = rotl32(s1 * 5, 7) * 9;
+                        uint32_t t = s1 << 9;
+                        s2 ^= s0;
+                        s3 ^= s1;
+                        s1 ^= s2;
+                        s0 ^= s3;
+                        s2 ^= t;
+                        s3 = rotl32(s3, 11);
+
+                        for (int c = 0; c < CANDIDATES && (need & (1 << lane)); ++c) {
+                            uint64_t bit = 1ull << ((value >> (6 * c)) & 63);
+                            if (used[lane] & bit) continue;
+                            used[lane] |= bit;
+                            group[lane] |= bit;
+                            need &= ~(1 << lane);
+                        }
+                    }
+                }
+            }
+        }
+        this->storeBlock(block, masks + static_cast<int64_t>(done) * this->groups_, std::min(LANES, count - done));
+    }
+}
@@ -0,0 +1,100 @@
+#include "../../include/core/DealSampler.h"
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+bool DealSampler::hasAvx2() {
+    return __builtin_cpu_supports("avx2");
+}
+
+__attribute__((target("avx2")))
+static __m256i rotl32(__m256i x, int k) {
+    return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+}
+
+__attribute__((target("avx2")))
+void DealSampler::sampleAvx2(uint64_t* masks, int count) {
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(this->state_[0]));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(this->state_[1]));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(this->state_[2]));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(this->state_[3]));
+    const __m256i field = _mm256_set1_epi64x(63);
+    const __m256i five = _mm256_set1_epi32(5);
+    const __m256i nine = _mm256_set1_epi32(9);
+    const __m256i one = _mm256_set1_epi64x(1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi32(-1);
+    const __m256i blockedBits = _mm256_set1_epi64x(static_cast<long long>(this->blocked()));
+
+    alignas(32) uint64_t block[MAX_GROUPS * LANES];
+    for (int done = 0; done < count; done += LANES) {
+        // Lanes 0-3 and 4-7 each keep their 64-bit masks in one register.
+        __m256i usedLow = blockedBits;
+        __m256i usedHigh = blockedBits;
+        for (int g = 0; g < this->groups_; ++g) {
+            __m256i groupLow = zero;
+            __m256i groupHigh = zero;
+            for (int card = 0; card < this->groupSizes_[g]; ++card) {
+                __m256i needLow = ones;
+                __m256i needHigh = ones;
+                do {
+                    __m256i value = _mm256_mullo_epi32(rotl32(_mm256_mullo_epi32(s1, five), 7), nine);
+                    __m256i t = _mm256_slli_epi32(s1, 9);
+                    s2 = _mm256_xor_si256(s2, s0);
+                    s3 = _mm256_xor_si256(s3, s1);
+                    s1 = _mm256_xor_si256(s1, s2);
+                    s0 = _mm256_xor_si256(s0, s3);
+                    s2 = _mm256_xor_si256(s2, t);
+                    s3 = rotl32(s3, 11);
+
+                    // Each candidate is a six-bit field of the draw, widened
+                    // to the 64-bit lanes holding the masks. A lane takes its
+                    // first free candidate: all are tested against the same
+                    // used mask, and walking them last to first, each free
+                    // one replaces the choice so far.
+                    __m256i fieldsLow = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(value));
+                    __m256i fieldsHigh = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(value, 1));
+                    __m256i bitLow = zero;
+                    __m256i bitHigh = zero;
+                    for (int c = CANDIDATES - 1; c >= 0; --c) {
+                        __m256i candidateLow = _mm256_sllv_epi64(one, _mm256_and_si256(_mm256_srli_epi64(fieldsLow, 6 * c), field));
+                        __m256i candidateHigh = _mm256_sllv_epi64(one, _mm256_and_si256(_mm256_srli_epi64(fieldsHigh, 6 * c), field));
+                        __m256i freeLow = _mm256_cmpeq_epi64(_mm256_and_si256(usedLow, candidateLow), zero);
+                        __m256i freeHigh = _mm256_cmpeq_epi64(_mm256_and_si256(usedHigh, candidateHigh), zero);
+                        bitLow = _mm256_blendv_epi8(bitLow, candidateLow, freeLow);
+                        bitHigh = _mm256_blendv_epi8(bitHigh, candidateHigh, freeHigh);
+                    }
+                    bitLow = _mm256_and_si256(bitLow, needLow);
+                    bitHigh = _mm256_and_si256(bitHigh, needHigh);
+                    usedLow = _mm256_or_si256(usedLow, bitLow);
+                    usedHigh = _mm256_or_si256(usedHigh, bitHigh);
+                    groupLow = _mm256_or_si256(groupLow, bitLow);
+                    groupHigh = _mm256_or_si256(groupHigh, bitHigh);
+                    needLow = _mm256_and_si256(_mm256_cmpeq_epi64(bitLow, zero), needLow);
+                    needHigh = _mm256_and_si256(_mm256_cmpeq_epi64(bitHigh, zero), needHigh);
+                } while (!_mm256_testz_si256(_mm256_or_si256(needLow, needHigh), ones));
+            }
+            _mm256_store_si256(reinterpret_cast<__m256i*>(block + g * LANES), groupLow);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(block + g * LANES + 4), groupHigh);
+        }
+        this->storeBlock(block, masks + static_cast<int64_t>(done) * this->groups_, std::min(LANES, count - done));
+    }
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(this->state_[0]), s0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(this->state_[1]), s1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(this->state_[2]), s2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(this->state_[3]), s3);
+}
+
+#else
+
+bool DealSampler::hasAvx2() {
+    return false;
+}
+
+void DealSampler::sampleAvx2(uint64_t* masks, int count) {
+    this->sampleScalar(masks, count);
+}
+
+#endif
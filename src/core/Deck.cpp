@@ -1,39 +1,56 @@
 #include "../../include/core/Deck.h"
 #include <algorithm>
-#include <random>
 #include <chrono>
 
-Deck::Deck() {
-    reset();
+Deck::Deck() : Deck(std::chrono::steady_clock::now().time_since_epoch().count()) {
 }
 
-void Deck::reset() {
-    cards_.clear();
-    for (int suit = SUIT_SPADES; suit <= SUIT_CLUBS; ++suit) {
-        for (int rank = RANK_TWO; rank <= RANK_ACE; ++rank) {
-            cards_.push_back(Card(rank, suit));
-        }
+Deck::Deck(uint64_t seed) : live_(Card::NUM_CARDS), drawn_(0), rng_(seed) {
+    for (int i = 0; i < Card::NUM_CARDS; ++i) {
+        cards_[i] = Card::fromIndex(i);
     }
 }
 
-void Deck::shuffle() {
-    if (cards_.empty()) {
+void Deck::reset(CardSet dead) {
+    drawn_ = 0;
+    if (dead == dead_) {
         return;
     }
-    
-    unsigned seed = std::chrono::steady_clock::now().time_since_epoch().count();
-    std::mt19937 rng(seed);
-    
-    std::shuffle(cards_.begin(), cards_.end(), rng);
+    // Partition live cards to the front, dead ones behind them.
+    dead_ = dead;
+    live_ = 0;
+    for (int i = 0; i < Card::NUM_CARDS; ++i) {
+        if (!dead.contains(cards_[i])) {
+            std::swap(cards_[live_++], cards_[i]);
+        }
+    }
 }
 
 Card Deck::draw() {
-    if (cards_.empty()) {
+    if (drawn_ == live_) {
         return Card();
     }
-    
-    Card card = cards_.back();
-    cards_.pop_back();
-    return card;
+    int pick = drawn_ + static_cast<int>(rng_.nextBelow(static_cast<uint32_t>(live_ - drawn_)));
+    std::swap(cards_[drawn_], cards_[pick]);
+    return cards_[drawn_++];
+}
+
+int Deck::drawN(Card* out, int count) {
+    count = std::min(count, live_ - drawn_);
+    for (int i = 0; i < count; ++i) {
+        out[i] = this->draw();
+    }
+    return count;
 }
 
+CardSet Deck::getRemainingSet() const {
+    CardSet remaining;
+    for (int i = drawn_; i < live_; ++i) {
+        remaining.insert(cards_[i]);
+    }
+    return remaining;
+}
+
+std::vector<Card> Deck::getRemainingCards() const {
+    return std::vector<Card>(cards_.begin() + drawn_, cards_.begin() + live_);
+}
@@ -0,0 +1,119 @@
+#include "../../include/core/ThreadPool.h"
+
+// Queue slot of the current thread: workers own 0..n-1, every other thread
+// submits through slot n.
+static thread_local size_t currentSlot = SIZE_MAX;
+
+ThreadPool::ThreadPool(unsigned numThreads) : pending_(0), stopping_(false) {
+    unsigned workers = numThreads > 1 ? numThreads - 1 : 0;
+    for (unsigned i = 0; i <= workers; ++i) {
+        this->queues_.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < workers; ++i) {
+        this->threads_.emplace_back(&ThreadPool::workerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->sleepMutex_);
+        this->stopping_ = true;
+    }
+    this->wake_.notify_all();
+    for (auto& thread : this->threads_) {
+        thread.join();
+    }
+}
+
+ThreadPool& ThreadPool::instance() {
+    static ThreadPool pool(std::thread::hardware_concurrency());
+    return pool;
+}
+
+bool ThreadPool::popTask(size_t self, Task& task) {
+    {
+        Queue& own = *this->queues_[self];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            task = own.tasks.back();
+            own.tasks.pop_back();
+            return true;
+        }
+    }
+    for (size_t offset = 1; offset < this->queues_.size(); ++offset) {
+        Queue& victim = *this->queues_[(self + offset) % this->queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::runOne(size_t self) {
+    Task task;
+    if (!this->popTask(self, task)) {
+        return false;
+    }
+    this->pending_--;
+    // A throwing task still counts as done, or parallelFor would wait on it
+    // forever; its exception goes back to the thread that started the batch.
+    try {
+        (*task.batch->body)(task.index);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(task.batch->errorMutex);
+        if (!task.batch->error) {
+            task.batch->error = std::current_exception();
+        }
+    }
+    task.batch->remaining.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+
+void ThreadPool::workerLoop(size_t self) {
+    currentSlot = self;
+    while (true) {
+        if (this->runOne(self)) continue;
+
+        std::unique_lock<std::mutex> lock(this->sleepMutex_);
+        this->wake_.wait(lock, [this] { return this->stopping_ || this->pending_ > 0; });
+        if (this->stopping_) return;
+    }
+}
+
+void ThreadPool::parallelFor(int count, const std::function<void(int)>& body) {
+    if (count <= 0) return;
+    if (this->threads_.empty() || count == 1) {
+        for (int i = 0; i < count; ++i) {
+            body(i);
+        }
+        return;
+    }
+
+    size_t self = currentSlot == SIZE_MAX ? this->threads_.size() : currentSlot;
+    Batch batch;
+    batch.body = &body;
+    batch.remaining = count;
+
+    for (int i = 0; i < count; ++i) {
+        Queue& queue = *this->queues_[i % this->queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(Task{&batch, i});
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->sleepMutex_);
+        this->pending_ += count;
+    }
+    this->wake_.notify_all();
+
+    while (batch.remaining.load(std::memory_order_acquire) > 0) {
+        if (!this->runOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+    if (batch.error) {
+        std::rethrow_exception(batch.error);
+    }
+}
@@ -0,0 +1,109 @@
+#include "../../include/game/EquityCache.h"
+#include "../../include/game/HandIndexer.h"
+#include <algorithm>
+#include <cstdio>
+
+EquityCache::Key EquityCache::canonicalKey(CardSet hand, CardSet board, int opponents) {
+    int boardCards = board.size();
+    return Key{HandIndexer::instance(2, boardCards).index(hand, board),
+               static_cast<uint32_t>(boardCards), static_cast<uint32_t>(opponents)};
+}
+
+EquityCache::EquityCache(size_t capacity) : hits_(0), misses_(0), evictions_(0) {
+    this->shardCapacity_ = std::max<size_t>(1, (capacity + NUM_SHARDS - 1) / NUM_SHARDS);
+    for (int i = 0; i < NUM_SHARDS; ++i) {
+        this->shards_.push_back(std::make_unique<Shard>());
+    }
+}
+
+bool EquityCache::find(const Key& key, float& equity) {
+    Shard& shard = this->shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        this->misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    shard.order.splice(shard.order.begin(), shard.order, it->second);
+    equity = it->second->second;
+    this->hits_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void EquityCache::insert(const Key& key, float equity) {
+    Shard& shard = this->shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        it->second->second = equity;
+        shard.order.splice(shard.order.begin(), shard.order, it->second);
+        return;
+    }
+    if (shard.index.size() >= this->shardCapacity_) {
+        shard.index.erase(shard.order.back().first);
+        shard.order.pop_back();
+        this->evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+    shard.order.emplace_front(key, equity);
+    shard.index[key] = shard.order.begin();
+}
+
+void EquityCache::clear() {
+    for (auto& shard : this->shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        shard->order.clear();
+        shard->index.clear();
+    }
+    this->hits_ = 0;
+    this->misses_ = 0;
+    this->evictions_ = 0;
+}
+
+size_t EquityCache::size() const {
+    size_t total = 0;
+    for (const auto& shard : this->shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->index.size();
+    }
+    return total;
+}
+
+bool EquityCache::save(const std::string& path) const {
+    std::vector<FileRecord> records;
+    for (const auto& shard : this->shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        // Least recently used first, so reloading restores the same order.
+        for (auto it = shard->order.rbegin(); it != shard->order.rend(); ++it) {
+            records.push_back(FileRecord{it->first.index, it->first.boardCards, it->first.opponents, it->second});
+        }
+    }
+
+    FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    FileHeader header = {FILE_MAGIC, FILE_VERSION, records.size()};
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   std::fwrite(records.data(), sizeof(FileRecord), records.size(), file) == records.size();
+    return std::fclose(file) == 0 && written;
+}
+
+bool EquityCache::load(const std::string& path) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        return false;
+    }
+    FileHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        header.magic != FILE_MAGIC || header.version != FILE_VERSION) {
+        std::fclose(file);
+        return false;
+    }
+
+    FileRecord record;
+    for (uint64_t i = 0; i < header.count && std::fread(&record, sizeof(record), 1, file) == 1; ++i) {
+        this->insert(Key{record.index, record.boardCards, record.opponents}, record.equity);
+    }
+    std::fclose(file);
+    return true;
+}
@@ -0,0 +1,313 @@
+#include "../../include/game/EquityEngine.h"
+#include "../../include/core/Combinatorics.h"
+#include "../../include/core/DealSampler.h"
+#include "../../include/core/ThreadPool.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+using Combinatorics::Combinations;
+
+EquityEngine::EquityEngine()
+    : tables(HandTables::instance()), rng(std::chrono::steady_clock::now().time_since_epoch().count()) {
+}
+
+// Heads-up showdown in half points (2 win, 1 tie, 0 loss), branch-free so
+// the batched loops below stay predictable.
+static int halfPoints(int heroValue, int villainValue) {
+    return (heroValue > villainValue) * 2 + (heroValue == villainValue);
+}
+
+void EquityEngine::enumerateRunout(int heroValue, CardSet board, CardSet live, double& equity, int64_t& deals) const {
+    uint64_t cards[Card::NUM_CARDS];
+    int count = 0;
+    for (Card card : live) {
+        cards[count++] = card.getBit();
+    }
+
+    uint64_t masks[MAX_HOLDINGS];
+    int32_t values[MAX_HOLDINGS];
+    int holdings = 0;
+    for (uint64_t pair : Combinations(count, 2)) {
+        masks[holdings++] = board.mask() | cards[__builtin_ctzll(pair)] | cards[63 - __builtin_clzll(pair)];
+    }
+    this->tables.evaluateBatch(masks, values, holdings);
+
+    int points = 0;
+    for (int k = 0; k < holdings; ++k) {
+        points += halfPoints(heroValue, values[k]);
+    }
+    equity += points * 0.5;
+    deals += holdings;
+}
+
+void EquityEngine::enumerateBoards(const uint64_t* cards, int count, int remaining, uint64_t firstPrefix,
+                                   uint64_t prefixes, CardSet hero, CardSet villain, double& equity, int64_t& deals) const {
+    // Every board is a colex-ordered prefix of remaining - 1 cards plus a
+    // last card above the prefix's highest; all completions of one prefix
+    // are scored for both players in one batch.
+    uint64_t masks[2 * Card::NUM_CARDS];
+    int32_t values[2 * Card::NUM_CARDS];
+    int points = 0;
+    for (uint64_t prefix : Combinations(count, remaining - 1, firstPrefix, prefixes)) {
+        uint64_t prefixCards = 0;
+        for (uint64_t bits = prefix; bits; bits &= bits - 1) {
+            prefixCards |= cards[__builtin_ctzll(bits)];
+        }
+        int start = prefix ? 64 - __builtin_clzll(prefix) : 0;
+        int boards = count - start;
+        for (int i = 0; i < boards; ++i) {
+            masks[2 * i] = hero.mask() | prefixCards | cards[start + i];
+            masks[2 * i + 1] = villain.mask() | prefixCards | cards[start + i];
+        }
+        this->tables.evaluateBatch(masks, values, 2 * boards);
+        for (int i = 0; i < boards; ++i) {
+            points += halfPoints(values[2 * i], values[2 * i + 1]);
+        }
+        deals += boards;
+    }
+    equity += points * 0.5;
+}
+
+void EquityEngine::sampleChunk(int missing, int numOpponents, CardSet hand, CardSet board,
+                               uint64_t seed, int samples, double& sum, double& sumSquares) const {
+    // Group 0 is the rest of the board, then two hole cards per opponent.
+    int groupSizes[DealSampler::MAX_GROUPS];
+    groupSizes[0] = missing;
+    for (int opp = 0; opp < numOpponents; ++opp) {
+        groupSizes[1 + opp] = 2;
+    }
+    int groups = 1 + numOpponents;
+    DealSampler sampler(hand | board, groupSizes, groups, seed);
+
+    // Deals are scored SAMPLE_BATCH at a time: every hero hand in one batch,
+    // then one batch per opponent over the deals the hero has not lost yet,
+    // which keeps the early exit of seat-by-seat scoring.
+    uint64_t deals[SAMPLE_BATCH * DealSampler::MAX_GROUPS];
+    uint64_t runouts[SAMPLE_BATCH];
+    uint64_t masks[SAMPLE_BATCH];
+    int32_t heroValues[SAMPLE_BATCH];
+    int32_t values[SAMPLE_BATCH];
+    int alive[SAMPLE_BATCH];
+    int tied[SAMPLE_BATCH];
+
+    for (int done = 0; done < samples; done += SAMPLE_BATCH) {
+        int batch = std::min(SAMPLE_BATCH, samples - done);
+        sampler.sample(deals, batch);
+        for (int s = 0; s < batch; ++s) {
+            runouts[s] = board.mask() | deals[s * groups];
+            masks[s] = runouts[s] | hand.mask();
+            alive[s] = s;
+            tied[s] = 0;
+        }
+        this->tables.evaluateBatch(masks, heroValues, batch);
+
+        int numAlive = batch;
+        for (int opp = 0; opp < numOpponents && numAlive > 0; ++opp) {
+            for (int a = 0; a < numAlive; ++a) {
+                masks[a] = runouts[alive[a]] | deals[alive[a] * groups + 1 + opp];
+            }
+            this->tables.evaluateBatch(masks, values, numAlive);
+
+            int kept = 0;
+            for (int a = 0; a < numAlive; ++a) {
+                int s = alive[a];
+                if (values[a] > heroValues[s]) continue;
+                tied[s] += values[a] == heroValues[s];
+                alive[kept++] = s;
+            }
+            numAlive = kept;
+        }
+
+        for (int a = 0; a < numAlive; ++a) {
+            double share = 1.0 / (tied[alive[a]] + 1);
+            sum += share;
+            sumSquares += share * share;
+        }
+    }
+}
+
+EquityResult EquityEngine::calculate(CardSet hand, CardSet board, int numOpponents, EquityBudget budget) {
+    if (numOpponents == 1 && board.size() >= 3) {
+        return this->exactEquity(hand, board);
+    }
+    return this->monteCarloEquity(hand, board, numOpponents, budget);
+}
+
+EquityResult EquityEngine::exactEquity(CardSet hand, CardSet board) {
+    EquityResult result;
+    if (hand.size() != 2 || board.size() < 3 || board.size() > 5 || hand.intersects(board)) {
+        return result;
+    }
+
+    CardSet live = CardSet::fullDeck() - hand - board;
+    Card cards[Card::NUM_CARDS];
+    int count = 0;
+    for (Card card : live) {
+        cards[count++] = card;
+    }
+
+    double equity = 0.0;
+    int64_t deals = 0;
+    int missing = 5 - board.size();
+
+    if (missing == 0) {
+        this->enumerateRunout(this->tables.evaluate(hand | board), board, live, equity, deals);
+    } else {
+        // Runouts are split into ROUND_CHUNKS equal colex rank ranges; chunk
+        // totals are summed in chunk order so the result does not depend on
+        // scheduling. The hero's hand follows the runout card by card
+        // instead of being rescored.
+        std::vector<double> chunkEquity(ROUND_CHUNKS, 0.0);
+        std::vector<int64_t> chunkDeals(ROUND_CHUNKS, 0);
+        ThreadPool::instance().parallelFor(ROUND_CHUNKS, [&](int chunk) {
+            IncrementalEvaluator hero(hand | board);
+            for (uint64_t subset : Combinations::slice(count, missing, chunk, ROUND_CHUNKS)) {
+                CardSet runout;
+                for (uint64_t bits = subset; bits; bits &= bits - 1) {
+                    runout.insert(cards[__builtin_ctzll(bits)]);
+                }
+                Card last = cards[63 - __builtin_clzll(subset)];
+                if (missing == 2) {
+                    hero.push(cards[__builtin_ctzll(subset)]);
+                }
+                this->enumerateRunout(hero.valueWith(last), board | runout, live - runout,
+                                      chunkEquity[chunk], chunkDeals[chunk]);
+                if (missing == 2) {
+                    hero.pop();
+                }
+            }
+        });
+        for (int chunk = 0; chunk < ROUND_CHUNKS; ++chunk) {
+            equity += chunkEquity[chunk];
+            deals += chunkDeals[chunk];
+        }
+    }
+
+    if (deals == 0) return result;
+
+    result.equity = static_cast<float>(equity / deals);
+    result.confidenceLow = result.equity;
+    result.confidenceHigh = result.equity;
+    result.samples = deals;
+    result.exact = true;
+    return result;
+}
+
+EquityResult EquityEngine::handVsHand(CardSet hero, CardSet villain, CardSet board) {
+    EquityResult result;
+    if (hero.size() != 2 || villain.size() != 2 || board.size() > 5 ||
+        hero.intersects(villain) || hero.intersects(board) || villain.intersects(board)) {
+        return result;
+    }
+
+    CardSet live = CardSet::fullDeck() - hero - villain - board;
+    uint64_t bits[Card::NUM_CARDS];
+    int count = 0;
+    for (Card card : live) {
+        bits[count++] = card.getBit();
+    }
+
+    double equity = 0.0;
+    int64_t deals = 0;
+    int missing = 5 - board.size();
+    if (missing == 0) {
+        equity = halfPoints(this->tables.evaluate(hero | board), this->tables.evaluate(villain | board)) * 0.5;
+        deals = 1;
+    } else {
+        // Board prefixes are split into ROUND_CHUNKS colex rank ranges.
+        uint64_t prefixes = Combinatorics::binomial(count, missing - 1);
+        int chunks = static_cast<int>(std::min<uint64_t>(ROUND_CHUNKS, prefixes));
+        std::vector<double> chunkEquity(chunks, 0.0);
+        std::vector<int64_t> chunkDeals(chunks, 0);
+        ThreadPool::instance().parallelFor(chunks, [&](int chunk) {
+            uint64_t first = prefixes * chunk / chunks;
+            uint64_t last = prefixes * (chunk + 1) / chunks;
+            this->enumerateBoards(bits, count, missing, first, last - first, hero | board, villain | board,
+                                  chunkEquity[chunk], chunkDeals[chunk]);
+        });
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            equity += chunkEquity[chunk];
+            deals += chunkDeals[chunk];
+        }
+    }
+
+    result.equity = static_cast<float>(equity / deals);
+    result.confidenceLow = result.equity;
+    result.confidenceHigh = result.equity;
+    result.samples = deals;
+    result.exact = true;
+    return result;
+}
+
+EquityResult EquityEngine::monteCarloEquity(CardSet hand, CardSet board, int numOpponents, EquityBudget budget) {
+    EquityResult result;
+    if (hand.size() != 2 || board.size() > 5 || hand.intersects(board) || numOpponents > MAX_OPPONENTS) {
+        return result;
+    }
+    if (numOpponents <= 0) {
+        result.equity = 1.0f;
+        result.confidenceLow = 1.0f;
+        result.confidenceHigh = 1.0f;
+        result.exact = true;
+        return result;
+    }
+
+    // With no samples allowed there is no estimate; samples stays 0.
+    if (budget.maxSamples <= 0) return result;
+    int missing = 5 - board.size();
+    int dealt = missing + numOpponents * 2;
+    if (dealt > (CardSet::fullDeck() - hand - board).size()) return result;
+
+    // Samples are drawn in rounds of ROUND_CHUNKS independent chunks, each
+    // with its own generator seeded from the engine's stream and its chunk
+    // number, so a seeded engine gives the same result on any thread count.
+    auto start = std::chrono::steady_clock::now();
+    uint64_t baseSeed = this->rng.next();
+    double sum = 0.0;
+    double sumSquares = 0.0;
+    int64_t samples = 0;
+    int64_t chunksDone = 0;
+    std::vector<double> chunkSums(ROUND_CHUNKS);
+    std::vector<double> chunkSquares(ROUND_CHUNKS);
+
+    while (samples < budget.maxSamples) {
+        int64_t remaining = budget.maxSamples - samples;
+        int chunks = static_cast<int>(std::min<int64_t>(ROUND_CHUNKS, (remaining + CHECK_INTERVAL - 1) / CHECK_INTERVAL));
+
+        // Only the last chunk of the budget can come up short.
+        ThreadPool::instance().parallelFor(chunks, [&](int chunk) {
+            int chunkSamples = static_cast<int>(std::min<int64_t>(CHECK_INTERVAL, remaining - static_cast<int64_t>(chunk) * CHECK_INTERVAL));
+            chunkSums[chunk] = 0.0;
+            chunkSquares[chunk] = 0.0;
+            this->sampleChunk(missing, numOpponents, hand, board,
+                              baseSeed + chunksDone + chunk, chunkSamples, chunkSums[chunk], chunkSquares[chunk]);
+        });
+        for (int chunk = 0; chunk < chunks; ++chunk) {
+            sum += chunkSums[chunk];
+            sumSquares += chunkSquares[chunk];
+        }
+        chunksDone += chunks;
+        samples += std::min<int64_t>(remaining, static_cast<int64_t>(chunks) * CHECK_INTERVAL);
+
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= budget.maxMillis) break;
+        if (samples >= budget.minSamples) {
+            double mean = sum / samples;
+            double variance = std::max(0.0, sumSquares / samples - mean * mean);
+            if (std::sqrt(variance / samples) <= budget.targetStandardError) break;
+        }
+    }
+
+    double mean = sum / samples;
+    double variance = std::max(0.0, sumSquares / samples - mean * mean);
+    double standardError = std::sqrt(variance / samples);
+
+    result.equity = static_cast<float>(mean);
+    result.standardError = static_cast<float>(standardError);
+    result.confidenceLow = static_cast<float>(std::max(0.0, mean - 1.96 * standardError));
+    result.confidenceHigh = static_cast<float>(std::min(1.0, mean + 1.96 * standardError));
+    result.samples = samples;
+    return result;
+}
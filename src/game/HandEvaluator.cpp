@@ -1,652 +1,329 @@
 #include "../../include/game/HandEvaluator.h"
+#include "../../include/game/HandTables.h"
+#include "../../include/game/PreflopTable.h"
 #include <algorithm>
-#include <unordered_set>
 #include <cmath>
-#include <map>
+#include <limits>
 
-int HandEvaluator::evaluateHand( std::vector<Card>& hand) {
-    if (hand.size() < 5) {
-        return 0;
+HandEvaluator::HandEvaluator(bool persistent) : persistent(persistent) {
+    if (!this->persistent) {
+        return;
     }
-    return getHandValue(hand);
+    this->headsUpMatrix.load(HEADS_UP_MATRIX_PATH);
+    this->equityCache.load(EQUITY_CACHE_PATH);
 }
 
-int HandEvaluator::evaluateBestHand( std::vector<Card>& playerHand, 
- std::vector<Card>& communityCards)  {
-    std::vector<Card> allCards;
-    allCards.insert(allCards.end(), playerHand.begin(), playerHand.end());
-    allCards.insert(allCards.end(), communityCards.begin(), communityCards.end());
-    
-    if (allCards.size() < 5) {
-        return 0;
+HandEvaluator::~HandEvaluator() {
+    if (this->persistent && this->equityCache.size() > 0) {
+        this->equityCache.save(EQUITY_CACHE_PATH);
     }
-    
-    std::vector<Card> bestFive = getBestFiveCards(allCards);
-    return getHandValue(bestFive);
 }
 
-std::vector<Card> HandEvaluator::getBestFiveCards( std::vector<Card>& cards)  {
-    if (cards.size() <= 5) {
-        std::vector<Card> result = cards;
-        std::sort(result.begin(), result.end(), [](Card a, Card b) {
-            return a.getRank() > b.getRank();
-        });
-        return result;
+bool HandEvaluator::loadHeadsUpMatrix(const std::string& path) {
+    return this->headsUpMatrix.load(path);
+}
+
+float HandEvaluator::handVsRangeEquity(const std::vector<Card>& hand, const std::vector<float>& villainRange,
+                                       const std::vector<Card>& deadCards) {
+    if (hand.size() != 2 || villainRange.size() != HeadsUpMatrix::NUM_COMBOS || !this->headsUpMatrix.isLoaded()) {
+        return 0.0f;
     }
-    
-    std::vector<std::vector<Card>> combinations;
-    std::vector<Card> current;
-    generateCombinations(cards, 5, combinations, current, 0);
-    
-    int maxValue = 0;
-    std::vector<Card> bestCombination;
-    
-    for ( auto& combo : combinations) {
-        int value = getHandValue(combo);
-        if (value > maxValue) {
-            maxValue = value;
-            bestCombination = combo;
+    CardSet hero(hand);
+    CardSet dead(deadCards);
+    if (hero.size() != 2 || hero.intersects(dead)) {
+        return 0.0f;
+    }
+
+    std::vector<float> liveRange(villainRange);
+    dead |= hero;
+    for (int combo = 0; combo < HeadsUpMatrix::NUM_COMBOS; ++combo) {
+        if (liveRange[combo] != 0.0f && HeadsUpMatrix::comboCards(combo).intersects(dead)) {
+            liveRange[combo] = 0.0f;
         }
     }
-    
-    return bestCombination;
+    return this->headsUpMatrix.comboVsRange(HeadsUpMatrix::comboIndex(hand[0], hand[1]), liveRange);
 }
 
-void HandEvaluator::generateCombinations( std::vector<Card>& availableCards,
-                                         int k,
-                                         std::vector<std::vector<Card>>& result,
-                                         std::vector<Card>& current,
-                                         int start)  {
-    if (current.size() == k) {
-        result.push_back(current);
-        return;
-    }
-    
-    for (int i = start; i < availableCards.size(); ++i) {
-        current.push_back(availableCards[i]);
-        generateCombinations(availableCards, k, result, current, i + 1);
-        current.pop_back();
-    }
+float HandEvaluator::rangeVsRangeEquity(const std::vector<float>& heroRange, const std::vector<float>& villainRange) {
+    return this->headsUpMatrix.rangeVsRange(heroRange, villainRange);
 }
 
-bool HandEvaluator::isRoyalFlush( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::vector<int> ranks;
-    int suit = cards[0].getSuit();
-    
-    for ( auto& card : cards) {
-        if (card.getSuit() != suit) return false;
-        ranks.push_back(card.getRank());
+int HandEvaluator::evaluateHand( const std::vector<Card>& hand) const {
+    if (hand.size() < 5 || hand.size() > 7) {
+        return 0;
     }
-    
-    std::sort(ranks.begin(), ranks.end());
-    return ranks[0] == RANK_TEN && ranks[1] == RANK_JACK && 
-           ranks[2] == RANK_QUEEN && ranks[3] == RANK_KING && ranks[4] == RANK_ACE;
+    return HandTables::instance().evaluate(CardSet(hand));
 }
 
-bool HandEvaluator::isStraightFlush( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    int suit = cards[0].getSuit();
-    std::vector<int> ranks;
-    
-    for ( auto& card : cards) {
-        if (card.getSuit() != suit) return false;
-        ranks.push_back(card.getRank());
-    }
-    
-    std::sort(ranks.begin(), ranks.end());
-    
-    bool isStraight = true;
-    for (size_t i = 1; i < ranks.size(); ++i) {
-        if (ranks[i] != ranks[i-1] + 1) {
-            isStraight = false;
-            break;
-        }
-    }
-    
-    if (!isStraight && ranks[0] == RANK_TWO && ranks[1] == RANK_THREE &&
-        ranks[2] == RANK_FOUR && ranks[3] == RANK_FIVE && ranks[4] == RANK_ACE) {
-        isStraight = true;
+int HandEvaluator::evaluateHand(CardSet cards) const {
+    if (cards.size() < 5 || cards.size() > 7) {
+        return 0;
     }
-    
-    return isStraight;
+    return HandTables::instance().evaluate(cards);
 }
 
-bool HandEvaluator::isFourOfAKind( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::map<int, int> rankCount;
-    for ( auto& card : cards) {
-        rankCount[card.getRank()]++;
-    }
-    
-    for ( auto& pair : rankCount) {
-        if (pair.second == 4) return true;
-    }
-    return false;
+void HandEvaluator::evaluateBatch(const CardSet* hands, int32_t* ranks, size_t count) const {
+    static_assert(sizeof(CardSet) == sizeof(uint64_t), "CardSet must be a bare 64-bit mask");
+    HandTables::instance().evaluateBatch(reinterpret_cast<const uint64_t*>(hands), ranks, static_cast<int>(count));
 }
 
-bool HandEvaluator::isFullHouse( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::map<int, int> rankCount;
-    for ( auto& card : cards) {
-        rankCount[card.getRank()]++;
-    }
-    
-    bool hasThree = false, hasPair = false;
-    for ( auto& pair : rankCount) {
-        if (pair.second == 3) hasThree = true;
-        if (pair.second == 2) hasPair = true;
-    }
-    
-    return hasThree && hasPair;
+int HandEvaluator::evaluateBestHand( const std::vector<Card>& playerHand, 
+ const std::vector<Card>& communityCards) const {
+    return this->evaluateBestHand(CardSet(playerHand), CardSet(communityCards));
 }
 
-bool HandEvaluator::isFlush( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    int suit = cards[0].getSuit();
-    for ( auto& card : cards) {
-        if (card.getSuit() != suit) return false;
+int HandEvaluator::evaluateBestHand(CardSet playerHand, CardSet communityCards) const {
+    CardSet allCards = playerHand | communityCards;
+    if (allCards.size() < 5 || allCards.size() > 7) {
+        return 0;
     }
-    return true;
+    return HandTables::instance().evaluate(allCards);
 }
 
-bool HandEvaluator::isStraight( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::vector<int> ranks;
-    for ( auto& card : cards) {
-        ranks.push_back(card.getRank());
+float HandEvaluator::calculateWinProbability( const std::vector<Card>& playerHand,
+ const std::vector<Card>& communityCards,
+                                            int numOpponents) {
+    if (playerHand.size() == 2 && communityCards.empty() && numOpponents > 0 &&
+        numOpponents <= PreflopTable::MAX_OPPONENTS) {
+        return PreflopTable::equity(playerHand[0], playerHand[1], numOpponents);
     }
-    std::sort(ranks.begin(), ranks.end());
-    
-    bool isStraight = true;
-    for (size_t i = 1; i < ranks.size(); ++i) {
-        if (ranks[i] != ranks[i-1] + 1) {
-            isStraight = false;
-            break;
-        }
+    if (playerHand.size() != 2 || communityCards.size() > 5) {
+        return 0.0f;
     }
-    
-    if (!isStraight && ranks[0] == RANK_TWO && ranks[1] == RANK_THREE &&
-        ranks[2] == RANK_FOUR && ranks[3] == RANK_FIVE && ranks[4] == RANK_ACE) {
-        isStraight = true;
+    if (communityCards.size() == 5 && numOpponents <= RiverTable::MAX_OPPONENTS) {
+        return this->getRiverTable(CardSet(communityCards)).equity(CardSet(playerHand), numOpponents);
     }
     
-    return isStraight;
+    EquityCache::Key key = EquityCache::canonicalKey(CardSet(playerHand), CardSet(communityCards), numOpponents);
+    float equity;
+    if (!this->equityCache.find(key, equity)) {
+        // Bots ask on the river, so there sampling stops on the sample
+        // count alone and a seeded game replays the same equities.
+        EquityBudget budget;
+        if (communityCards.size() == 5) {
+            budget.maxMillis = std::numeric_limits<double>::infinity();
+        }
+        equity = this->calculateEquity(playerHand, communityCards, numOpponents, budget).equity;
+        this->equityCache.insert(key, equity);
+    }
+    return equity;
 }
 
-bool HandEvaluator::isThreeOfAKind( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::map<int, int> rankCount;
-    for ( auto& card : cards) {
-        rankCount[card.getRank()]++;
-    }
-    
-    for ( auto& pair : rankCount) {
-        if (pair.second == 3) return true;
+const RiverTable& HandEvaluator::getRiverTable(CardSet board) {
+    if (!this->riverTable || this->riverTable->board() != board) {
+        this->riverTable = std::make_unique<RiverTable>(board);
     }
-    return false;
+    return *this->riverTable;
 }
 
-bool HandEvaluator::isTwoPair( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::map<int, int> rankCount;
-    for ( auto& card : cards) {
-        rankCount[card.getRank()]++;
+EquityResult HandEvaluator::calculateEquity(const std::vector<Card>& playerHand,
+                                            const std::vector<Card>& communityCards,
+                                            int numOpponents,
+                                            EquityBudget budget) {
+    if (playerHand.size() != 2 || communityCards.size() > 5) {
+        return EquityResult();
     }
     
-    int pairCount = 0;
-    for ( auto& pair : rankCount) {
-        if (pair.second == 2) pairCount++;
-    }
-    
-    return pairCount == 2;
+    return this->equityEngine.calculate(CardSet(playerHand), CardSet(communityCards), numOpponents, budget);
 }
 
-bool HandEvaluator::isOnePair( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return false;
-    
-    std::map<int, int> rankCount;
-    for ( auto& card : cards) {
-        rankCount[card.getRank()]++;
-    }
-    
-    int pairCount = 0;
-    for ( auto& pair : rankCount) {
-        if (pair.second == 2) pairCount++;
+int HandEvaluator::currentHandValue(CardSet cards) {
+    if (cards != this->cachedCards || this->cachedValue < 0) {
+        this->cachedCards = cards;
+        this->cachedValue = this->evaluateHand(cards);
     }
-    
-    return pairCount == 1;
+    return this->cachedValue;
 }
 
-int HandEvaluator::getHandValue( std::vector<Card>& cards)  {
-    if (cards.size() != 5) return 0;
-    
-    std::vector<Card> sortedCards = cards;
-    std::sort(sortedCards.begin(), sortedCards.end(), []( Card& a,  Card& b) {
-        return a.getRank() > b.getRank();
-    });
-    
-    if (isRoyalFlush(sortedCards)) {
-        return HAND_ROYAL_FLUSH;
+std::vector<OutsGroup> HandEvaluator::findOutsByCategory(const std::vector<Card>& hand,
+                                                         const std::vector<Card>& community,
+                                                         const std::vector<std::vector<Card>>& opponentHands) {
+    if (hand.size() != 2 || community.size() >= 5) {
+        return {};
     }
     
-    if (isStraightFlush(sortedCards)) {
-        return HAND_STRAIGHT_FLUSH + sortedCards[0].getRank();
+    CardSet cards = CardSet(hand) | CardSet(community);
+    CardSet deadCards = cards;
+    for (const auto& oppHand : opponentHands) {
+        deadCards |= CardSet(oppHand);
     }
     
-    if (isFourOfAKind(sortedCards)) {
-        std::map<int, int> rankCount;
-        for ( auto& card : sortedCards) {
-            rankCount[card.getRank()]++;
-        }
-        int fourRank = 0, kicker = 0;
-        for ( auto& pair : rankCount) {
-            if (pair.second == 4) fourRank = pair.first;
-            else kicker = pair.first;
-        }
-        return HAND_FOUR_OF_A_KIND + fourRank * 100 + kicker;
-    }
+    const HandTables& tables = HandTables::instance();
+    int currentType = tables.category(this->currentHandValue(cards));
+    IncrementalEvaluator current(cards);
     
-    if (isFullHouse(sortedCards)) {
-        std::map<int, int> rankCount;
-        for ( auto& card : sortedCards) {
-            rankCount[card.getRank()]++;
+    // Each unseen card is scored once and filed under the category it makes.
+    std::vector<Card> outsByType[HAND_CATEGORIES];
+    for (Card card : CardSet::fullDeck() - deadCards) {
+        int type = tables.category(current.valueWith(card));
+        if (type > currentType) {
+            outsByType[type].push_back(card);
         }
-        int threeRank = 0, pairRank = 0;
-        for ( auto& pair : rankCount) {
-            if (pair.second == 3) threeRank = pair.first;
-            if (pair.second == 2) pairRank = pair.first;
-        }
-        return HAND_FULL_HOUSE + threeRank * 100 + pairRank;
     }
     
-    if (isFlush(sortedCards)) {
-        int value = HAND_FLUSH;
-        for ( auto& card : sortedCards) {
-            value = value * 100 + card.getRank();
+    std::vector<OutsGroup> groups;
+    for (int type = HAND_CATEGORIES - 1; type > currentType; --type) {
+        if (!outsByType[type].empty()) {
+            OutsGroup group;
+            group.handType = type;
+            group.cards = std::move(outsByType[type]);
+            groups.push_back(std::move(group));
         }
-        return value;
     }
-    
-    if (isStraight(sortedCards)) {
-        int highCard = sortedCards[0].getRank();
-        if (sortedCards[0].getRank() == RANK_ACE && sortedCards[1].getRank() == RANK_FIVE) {
-            highCard = RANK_FIVE;
+    return groups;
+}
+
+TrueOuts HandEvaluator::findTrueOuts(const std::vector<Card>& hand,
+                                     const std::vector<Card>& community,
+                                     const std::vector<std::vector<Card>>& opponentHands) {
+    TrueOuts outs;
+    if (hand.size() != 2 || community.size() < 3 || community.size() >= 5) {
+        return outs;
+    }
+    
+    CardSet board(community);
+    CardSet deadCards = CardSet(hand) | board;
+    std::vector<CardSet> holdings = {CardSet(hand)};
+    for (const auto& oppHand : opponentHands) {
+        if (oppHand.size() == 2) {
+            holdings.push_back(CardSet(oppHand));
+            deadCards |= holdings.back();
         }
-        return HAND_STRAIGHT + highCard;
     }
-    
-    if (isThreeOfAKind(sortedCards)) {
-        std::map<int, int> rankCount;
-        for ( auto& card : sortedCards) {
-            rankCount[card.getRank()]++;
-        }
-        int threeRank = 0;
-        std::vector<int> kickers;
-        for ( auto& pair : rankCount) {
-            if (pair.second == 3) threeRank = pair.first;
-            else kickers.push_back(pair.first);
-        }
-        std::sort(kickers.begin(), kickers.end(), std::greater<int>());
-        return HAND_THREE_OF_A_KIND + threeRank * 10000 + 
-               (kickers.size() > 0 ? kickers[0] * 100 : 0) + 
-               (kickers.size() > 1 ? kickers[1] : 0);
+    if (holdings.size() < 2) {
+        return outs;
     }
     
-    if (isTwoPair(sortedCards)) {
-        std::map<int, int> rankCount;
-        for ( auto& card : sortedCards) {
-            rankCount[card.getRank()]++;
-        }
-        std::vector<int> pairs;
-        int kicker = 0;
-        for ( auto& pair : rankCount) {
-            if (pair.second == 2) pairs.push_back(pair.first);
-            else kicker = pair.first;
+    // One row per player: every unseen card, then the board as it stands,
+    // all scored in a single batch.
+    std::vector<Card> cards = (CardSet::fullDeck() - deadCards).toCards();
+    size_t row = cards.size() + 1;
+    std::vector<CardSet> masks(holdings.size() * row);
+    for (size_t p = 0; p < holdings.size(); ++p) {
+        for (size_t i = 0; i < cards.size(); ++i) {
+            masks[p * row + i] = holdings[p] | board | CardSet(CardSet::bitOf(cards[i]));
         }
-        std::sort(pairs.begin(), pairs.end(), std::greater<int>());
-        return HAND_TWO_PAIR + pairs[0] * 10000 + pairs[1] * 100 + kicker;
+        masks[p * row + cards.size()] = holdings[p] | board;
     }
+    std::vector<int32_t> values(masks.size());
+    this->evaluateBatch(masks.data(), values.data(), masks.size());
     
-    if (isOnePair(sortedCards)) {
-        std::map<int, int> rankCount;
-        for ( auto& card : sortedCards) {
-            rankCount[card.getRank()]++;
-        }
-        int pairRank = 0;
-        std::vector<int> kickers;
-        for ( auto& pair : rankCount) {
-            if (pair.second == 2) pairRank = pair.first;
-            else kickers.push_back(pair.first);
+    auto bestOpponent = [&](size_t i) {
+        int32_t best = 0;
+        for (size_t p = 1; p < holdings.size(); ++p) {
+            best = std::max(best, values[p * row + i]);
         }
-        std::sort(kickers.begin(), kickers.end(), std::greater<int>());
-        return HAND_ONE_PAIR + pairRank * 1000000 + 
-               (kickers.size() > 0 ? kickers[0] * 10000 : 0) +
-               (kickers.size() > 1 ? kickers[1] * 100 : 0) +
-               (kickers.size() > 2 ? kickers[2] : 0);
-    }
-    
-    int value = HAND_HIGH_CARD;
-    for ( auto& card : sortedCards) {
-        value = value * 100 + card.getRank();
-    }
-    return value;
-}
-
-std::vector<Card> HandEvaluator::getAvailableCards(std::vector<Card>& hand,
-                                                    std::vector<Card>& community,
-                                                    std::vector<std::vector<Card>> opponentHands) {
-    std::vector<Card> allUsed;
-    allUsed.insert(allUsed.end(), hand.begin(), hand.end());
-    allUsed.insert(allUsed.end(), community.begin(), community.end());
+        return best;
+    };
     
-    for ( auto& oppHand : opponentHands) {
-        allUsed.insert(allUsed.end(), oppHand.begin(), oppHand.end());
+    int32_t currentBest = bestOpponent(cards.size());
+    int32_t currentHero = values[cards.size()];
+    if (currentHero > currentBest) {
+        return outs;
     }
     
-    std::vector<Card> available;
-    for (int suit = SUIT_SPADES; suit <= SUIT_CLUBS; ++suit) {
-        for (int rank = RANK_TWO; rank <= RANK_ACE; ++rank) {
-            Card card(rank, suit);
-            bool isUsed = false;
-            for ( auto& used : allUsed) {
-                if (used == card) {
-                    isUsed = true;
-                    break;
-                }
-            }
-            if (!isUsed) {
-                available.push_back(card);
-            }
+    for (size_t i = 0; i < cards.size(); ++i) {
+        int32_t best = bestOpponent(i);
+        if (values[i] > best) {
+            outs.winning.push_back(cards[i]);
+        } else if (values[i] == best && currentHero < currentBest) {
+            outs.tying.push_back(cards[i]);
         }
     }
-    
-    return available;
+    return outs;
 }
 
-float HandEvaluator::calculateWinProbability( std::vector<Card>& playerHand,
- std::vector<Card>& communityCards,
-                                            int numOpponents) {
-    if (playerHand.size() != 2) {
-        return 0.0f;
+std::vector<DrawOdds> HandEvaluator::calculateDrawOdds(const std::vector<Card>& hand,
+                                                       const std::vector<Card>& community,
+                                                       const std::vector<std::vector<Card>>& opponentHands) {
+    if (hand.size() != 2 || community.size() < 3 || community.size() >= 5) {
+        return {};
     }
     
-    if (communityCards.empty()) {
-        return calculateEquityPreFlop(playerHand, numOpponents);
-    } else if (communityCards.size() == 3) {
-        return calculateEquityPostFlop(playerHand, communityCards, numOpponents);
-    } else if (communityCards.size() == 4) {
-        return calculateEquityPostTurn(playerHand, communityCards, numOpponents);
-    } else if (communityCards.size() == 5) {
-        int playerHandValue = evaluateBestHand(playerHand, communityCards);
-        if (playerHandValue >= HAND_FULL_HOUSE) return 0.9f;
-        if (playerHandValue >= HAND_FLUSH) return 0.7f;
-        if (playerHandValue >= HAND_STRAIGHT) return 0.6f;
-        if (playerHandValue >= HAND_THREE_OF_A_KIND) return 0.5f;
-        return 0.3f;
+    CardSet cards = CardSet(hand) | CardSet(community);
+    CardSet deadCards = cards;
+    for (const auto& oppHand : opponentHands) {
+        deadCards |= CardSet(oppHand);
     }
     
-    return 0.0f;
-}
-
-float HandEvaluator::calculateEquityPreFlop( std::vector<Card>& playerHand, int numOpponents)  {
-    int rank1 = playerHand[0].getRank();
-    int rank2 = playerHand[1].getRank();
-    bool suited = playerHand[0].getSuit() == playerHand[1].getSuit();
-    bool paired = rank1 == rank2;
-    
-    float baseEquity = 0.0f;
-    
-    if (paired) {
-        if (rank1 >= RANK_TEN) baseEquity = 0.85f;
-        else if (rank1 >= RANK_SEVEN) baseEquity = 0.75f;
-        else baseEquity = 0.65f;
-    } else if (rank1 == RANK_ACE || rank2 == RANK_ACE) {
-        int otherRank = (rank1 == RANK_ACE) ? rank2 : rank1;
-        if (otherRank >= RANK_TEN) baseEquity = suited ? 0.75f : 0.70f;
-        else if (otherRank >= RANK_SEVEN) baseEquity = suited ? 0.65f : 0.60f;
-        else baseEquity = suited ? 0.55f : 0.50f;
-    } else {
-        int highRank = std::max(rank1, rank2);
-        int lowRank = std::min(rank1, rank2);
-        bool connected = std::abs(highRank - lowRank) <= 4;
-        
-        if (highRank >= RANK_KING) {
-            baseEquity = (suited && connected) ? 0.60f : (suited ? 0.55f : 0.50f);
-        } else if (highRank >= RANK_TEN) {
-            baseEquity = (suited && connected) ? 0.50f : (suited ? 0.45f : 0.40f);
-        } else {
-            baseEquity = (suited && connected) ? 0.40f : (suited ? 0.35f : 0.30f);
-        }
-    }
-    
-    float equity = baseEquity;
-    for (int i = 0; i < numOpponents; ++i) {
-        equity *= 0.85f;
+    // The table only changes when a card is dealt, so redraws within a
+    // street reuse the last result.
+    if (cards == this->drawOddsCards && deadCards == this->drawOddsDead) {
+        return this->drawOdds;
     }
     
-    return std::max(0.0f, std::min(1.0f, equity));
-}
-
-float HandEvaluator::calculateEquityPostFlop( std::vector<Card>& playerHand,
- std::vector<Card>& communityCards,
-                                             int numOpponents)  {
-    std::vector<Card> availableCards = getAvailableCards(playerHand, communityCards, {});
-    
-    if (availableCards.size() < 2) return 0.0f;
-    
-    std::vector<std::vector<Card>> turnRiverCombos;
-    std::vector<Card> current;
-    generateCombinations(availableCards, 2, turnRiverCombos, current, 0);
+    const HandTables& tables = HandTables::instance();
+    int currentType = tables.category(this->currentHandValue(cards));
+    IncrementalEvaluator current(cards);
+    std::vector<Card> unseen = (CardSet::fullDeck() - deadCards).toCards();
+    int numUnseen = static_cast<int>(unseen.size());
     
- int MAX_COMBOS = 1000;
-    if (turnRiverCombos.size() > MAX_COMBOS) {
-        turnRiverCombos.resize(MAX_COMBOS);
+    int nextCardTypes[Card::NUM_CARDS];
+    int64_t nextCardHits[HAND_CATEGORIES] = {};
+    for (int i = 0; i < numUnseen; ++i) {
+        nextCardTypes[i] = tables.category(current.valueWith(unseen[i]));
+        nextCardHits[nextCardTypes[i]]++;
     }
     
-    int wins = 0;
-    int ties = 0;
-    int total = 0;
-    
-    int playerBestHand = evaluateBestHand(playerHand, communityCards);
-    
-    for ( auto& combo : turnRiverCombos) {
-        std::vector<Card> fullBoard = communityCards;
-        fullBoard.insert(fullBoard.end(), combo.begin(), combo.end());
-        
-        int playerHandValue = evaluateBestHand(playerHand, fullBoard);
-        
-        bool playerWins = true;
-        bool hasTie = false;
-        
-        for (int opp = 0; opp < numOpponents; ++opp) {
-            std::vector<Card> remainingForOpp = availableCards;
-            for ( auto& card : combo) {
-                remainingForOpp.erase(
-                    std::remove_if(remainingForOpp.begin(), remainingForOpp.end(),
-                        [&card]( Card& c) { return c == card; }),
-                    remainingForOpp.end()
-                );
-            }
-            
-            if (remainingForOpp.size() < 2) continue;
-            
-            std::vector<Card> oppHand = {remainingForOpp[0], remainingForOpp[1]};
-            int oppHandValue = evaluateBestHand(oppHand, fullBoard);
-            
-            if (oppHandValue > playerHandValue) {
-                playerWins = false;
-                break;
-            } else if (oppHandValue == playerHandValue) {
-                hasTie = true;
+    // Runouts are counted by the best category either card makes alone and
+    // the category the hand ends in; on the turn both are the river card's.
+    int64_t runoutHits[HAND_CATEGORIES][HAND_CATEGORIES] = {};
+    int64_t runouts = 0;
+    if (community.size() == 3) {
+        for (int i = 0; i < numUnseen; ++i) {
+            current.push(unseen[i]);
+            for (int j = i + 1; j < numUnseen; ++j) {
+                int type = tables.category(current.valueWith(unseen[j]));
+                runoutHits[std::max(nextCardTypes[i], nextCardTypes[j])][type]++;
             }
+            current.pop();
         }
-        
-        if (playerWins && !hasTie) {
-            wins++;
-        } else if (hasTie) {
-            ties++;
+        runouts = static_cast<int64_t>(numUnseen) * (numUnseen - 1) / 2;
+    } else {
+        for (int i = 0; i < numUnseen; ++i) {
+            runoutHits[nextCardTypes[i]][nextCardTypes[i]]++;
         }
-        total++;
-    }
-    
-    if (total == 0) return 0.0f;
-    
-    return static_cast<float>(wins + ties * 0.5f) / total;
-}
-
-float HandEvaluator::calculateEquityPostTurn( std::vector<Card>& playerHand,
- std::vector<Card>& communityCards,
-                                             int numOpponents)  {
-    std::vector<Card> availableCards = getAvailableCards(playerHand, communityCards, {});
-    
-    if (availableCards.empty()) return 0.0f;
-    
-    int wins = 0;
-    int ties = 0;
-    int total = 0;
-    
-    int playerCurrentHand = evaluateBestHand(playerHand, communityCards);
-    
-    for ( auto& riverCard : availableCards) {
-        std::vector<Card> fullBoard = communityCards;
-        fullBoard.push_back(riverCard);
-        
-        int playerHandValue = evaluateBestHand(playerHand, fullBoard);
-        
-        bool playerWins = true;
-        bool hasTie = false;
-        
-        std::vector<Card> remainingForOpp = availableCards;
-        remainingForOpp.erase(
-            std::remove_if(remainingForOpp.begin(), remainingForOpp.end(),
-                [&riverCard]( Card& c) { return c == riverCard; }),
-            remainingForOpp.end()
-        );
-        
-        for (int opp = 0; opp < numOpponents && remainingForOpp.size() >= 2; ++opp) {
-            std::vector<Card> oppHand = {remainingForOpp[0], remainingForOpp[1]};
-            int oppHandValue = evaluateBestHand(oppHand, fullBoard);
-            
-            if (oppHandValue > playerHandValue) {
-                playerWins = false;
-                break;
-            } else if (oppHandValue == playerHandValue) {
-                hasTie = true;
+        runouts = numUnseen;
+    }
+    
+    // A category is reached by any runout ending in it or a better one.
+    std::vector<DrawOdds> odds;
+    int64_t nextCardReached = 0;
+    for (int type = HAND_CATEGORIES - 1; type > currentType; --type) {
+        nextCardReached += nextCardHits[type];
+        int64_t riverReached = 0;
+        int64_t runnerRunnerReached = 0;
+        for (int single = 0; single < HAND_CATEGORIES; ++single) {
+            for (int made = type; made < HAND_CATEGORIES; ++made) {
+                riverReached += runoutHits[single][made];
+                if (single < type) {
+                    runnerRunnerReached += runoutHits[single][made];
+                }
             }
-            
-            remainingForOpp.erase(remainingForOpp.begin(), remainingForOpp.begin() + 2);
         }
-        
-        if (playerWins && !hasTie) {
-            wins++;
-        } else if (hasTie) {
-            ties++;
+        if (riverReached == 0) {
+            continue;
         }
-        total++;
-    }
-    
-    if (total == 0) return 0.0f;
-    
-    return static_cast<float>(wins + ties * 0.5f) / total;
+        DrawOdds entry;
+        entry.handType = type;
+        entry.nextCard = numUnseen > 0 ? static_cast<double>(nextCardReached) / numUnseen : 0.0;
+        entry.byRiver = static_cast<double>(riverReached) / runouts;
+        entry.runnerRunner = static_cast<double>(runnerRunnerReached) / runouts;
+        odds.push_back(entry);
+    }
+    
+    this->drawOddsCards = cards;
+    this->drawOddsDead = deadCards;
+    this->drawOdds = odds;
+    return odds;
 }
 
-bool HandEvaluator::improvesToHandType(std::vector<Card>& hand,
-                                       std::vector<Card>& community,
-                                       Card testCard,
-                                      int targetHandType)  {
-    std::vector<Card> testBoard = community;
-    testBoard.push_back(testCard);
-    
-    int currentValue = evaluateBestHand(hand, community);
-    int testValue = evaluateBestHand(hand, testBoard);
-    
-    int currentType = (currentValue / 1000000) * 1000000;
-    int testType = (testValue / 1000000) * 1000000;
-    
-    return testType >= targetHandType && testType > currentType;
-}
-
-std::vector<Card> HandEvaluator::findOuts( std::vector<Card>& hand,
- std::vector<Card>& community,
- std::vector<std::vector<Card>>& opponentHands) {
-    if (hand.size() != 2) {
-        return {};
-    }
-    
-    std::vector<Card> availableCards = getAvailableCards(hand, community, opponentHands);
-    
-    if (availableCards.empty()) {
-        return {};
-    }
-    
-    int currentHandValue = evaluateBestHand(hand, community);
-    int currentHandType = (currentHandValue / 1000000) * 1000000;
-    
-    std::unordered_map<int, std::vector<Card>> outsByType;
-    
-    int handTypes[] = {
-        HAND_ROYAL_FLUSH,
-        HAND_STRAIGHT_FLUSH,
-        HAND_FOUR_OF_A_KIND,
-        HAND_FULL_HOUSE,
-        HAND_FLUSH,
-        HAND_STRAIGHT,
-        HAND_THREE_OF_A_KIND,
-        HAND_TWO_PAIR,
-        HAND_ONE_PAIR
-    };
-    
-    for (int targetType : handTypes) {
-        if (targetType <= currentHandType) {
-            continue;
-        }
-        
-        for (auto& testCard : availableCards) {
-            if (improvesToHandType(hand, community, testCard, targetType)) {
-                bool isPureOut = true;
-                for (int strongerType : handTypes) {
-                    if (strongerType > targetType && 
-                        improvesToHandType(hand, community, testCard, strongerType)) {
-                        isPureOut = false;
-                        break;
-                    }
-                }
-                
-                if (isPureOut) {
-                    bool alreadyExists = false;
-                    for (auto& existingCard : outsByType[targetType]) {
-                        if (existingCard == testCard) {
-                            alreadyExists = true;
-                            break;
-                        }
-                    }
-                    if (!alreadyExists) {
-                        outsByType[targetType].push_back(testCard);
-                    }
-                }
-            }
-        }
-    }
-    
+std::vector<Card> HandEvaluator::findOuts( const std::vector<Card>& hand,
+ const std::vector<Card>& community,
+ const std::vector<std::vector<Card>>& opponentHands) {
     std::vector<Card> result;
-    for (int i = 0; i < 9; ++i) {
-        int targetType = handTypes[i];
-        if (outsByType.find(targetType) != outsByType.end()) {
-            for (auto& card : outsByType[targetType]) {
-                result.push_back(card);
-            }
-        }
+    for (auto& group : this->findOutsByCategory(hand, community, opponentHands)) {
+        result.insert(result.end(), group.cards.begin(), group.cards.end());
     }
-    
     return result;
 }
-
@@ -0,0 +1,201 @@
+#include "../../include/game/HandIndexer.h"
+#include "../../include/core/Combinatorics.h"
+#include <algorithm>
+#include <functional>
+#include <memory>
+
+using Combinatorics::binomial;
+
+namespace {
+
+const int NUM_RANKS = 13;
+
+constexpr int shapeCode(int hole, int board) { return hole * 8 + board; }
+constexpr int shapeHole(int code) { return code >> 3; }
+constexpr int shapeBoard(int code) { return code & 7; }
+
+// Rank sets a suit of this shape can hold.
+uint64_t suitSpace(int code) {
+    return binomial(NUM_RANKS, shapeHole(code)) *
+           binomial(NUM_RANKS - shapeHole(code), shapeBoard(code));
+}
+
+// Colex rank of a rank set within the ranks not in removed.
+uint64_t colexRankWithout(int mask, int removed) {
+    uint64_t rank = 0;
+    for (int k = 1; mask; ++k) {
+        int rankBit = __builtin_ctz(mask);
+        int position = rankBit - __builtin_popcount(removed & ((1 << rankBit) - 1));
+        rank += binomial(position, k);
+        mask &= mask - 1;
+    }
+    return rank;
+}
+
+int expandRanks(int compressed, int removed) {
+    int result = 0;
+    for (int rank = 0, bit = 0; rank < NUM_RANKS; ++rank) {
+        if (removed & (1 << rank)) continue;
+        if (compressed & (1 << bit)) result |= 1 << rank;
+        ++bit;
+    }
+    return result;
+}
+
+// C(a, k) for the group sizes a multiset of suits can have, with the
+// divisions by constants left to the compiler.
+uint64_t smallBinomial(uint64_t a, int k) {
+    switch (k) {
+        case 1: return a;
+        case 2: return a * (a - 1) / 2;
+        case 3: return a * (a - 1) * (a - 2) / 6;
+        case 4: return a * (a - 1) * (a - 2) * (a - 3) / 24;
+        default: return 1;
+    }
+}
+
+// Largest a with C(a, k) <= rank.
+int largestBinomialBelow(uint64_t rank, int k) {
+    int low = k - 1, high = k;
+    while (binomial(high, k) <= rank) {
+        low = high;
+        high *= 2;
+    }
+    while (high - low > 1) {
+        int middle = (low + high) / 2;
+        if (binomial(middle, k) <= rank) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+struct SuitRank {
+    int code;
+    uint64_t rank;
+
+    bool operator>(const SuitRank& other) const {
+        return code != other.code ? code > other.code : rank > other.rank;
+    }
+};
+
+}
+
+HandIndexer::HandIndexer(int holeCards, int boardCards)
+    : holeCards_(holeCards), boardCards_(boardCards), size_(0) {
+    int shapes[4] = {0, 0, 0, 0};
+    this->addConfigurations(0, shapes, holeCards, boardCards);
+    std::sort(this->configurations_.begin(), this->configurations_.end(),
+              [](const Configuration& a, const Configuration& b) { return a.key < b.key; });
+
+    for (auto& configuration : this->configurations_) {
+        configuration.offset = this->size_;
+        uint64_t blockSize = 1;
+        for (int start = 0, end; start < 4; start = end) {
+            uint32_t code = (configuration.key >> (15 - 5 * start)) & 31;
+            for (end = start + 1; end < 4 && ((configuration.key >> (15 - 5 * end)) & 31) == code; ++end) {}
+            int suits = end - start;
+            configuration.multipliers[start] = blockSize;
+            blockSize *= binomial(static_cast<int>(suitSpace(code)) + suits - 1, suits);
+        }
+        this->size_ += blockSize;
+    }
+}
+
+void HandIndexer::addConfigurations(int suit, int shapes[4], int holeLeft, int boardLeft) {
+    if (suit == 4) {
+        if (holeLeft == 0 && boardLeft == 0) {
+            uint32_t key = static_cast<uint32_t>(shapes[0] << 15 | shapes[1] << 10 | shapes[2] << 5 | shapes[3]);
+            this->configurations_.push_back(Configuration{key, 0, {0, 0, 0, 0}});
+        }
+        return;
+    }
+    int previous = suit > 0 ? shapes[suit - 1] : shapeCode(MAX_HOLE_CARDS, MAX_BOARD_CARDS);
+    for (int hole = 0; hole <= holeLeft; ++hole) {
+        for (int board = 0; board <= boardLeft && hole + board <= NUM_RANKS; ++board) {
+            if (shapeCode(hole, board) > previous) continue;
+            shapes[suit] = shapeCode(hole, board);
+            this->addConfigurations(suit + 1, shapes, holeLeft - hole, boardLeft - board);
+        }
+    }
+}
+
+const HandIndexer& HandIndexer::instance(int holeCards, int boardCards) {
+    static const std::vector<std::unique_ptr<HandIndexer>> indexers = [] {
+        std::vector<std::unique_ptr<HandIndexer>> result;
+        for (int hole = 0; hole <= MAX_HOLE_CARDS; ++hole) {
+            for (int board = 0; board <= MAX_BOARD_CARDS; ++board) {
+                result.push_back(std::make_unique<HandIndexer>(hole, board));
+            }
+        }
+        return result;
+    }();
+    return *indexers[holeCards * (MAX_BOARD_CARDS + 1) + boardCards];
+}
+
+uint64_t HandIndexer::index(CardSet hole, CardSet board) const {
+    SuitRank suits[4];
+    for (int suit = 0; suit < 4; ++suit) {
+        int holeRanks = hole.suitMask(suit);
+        int boardRanks = board.suitMask(suit);
+        int holeCount = __builtin_popcount(holeRanks);
+        int boardCount = __builtin_popcount(boardRanks);
+        suits[suit].code = shapeCode(holeCount, boardCount);
+        suits[suit].rank = Combinatorics::colexRank(holeRanks) * binomial(NUM_RANKS - holeCount, boardCount) +
+                           colexRankWithout(boardRanks, holeRanks);
+    }
+    std::sort(suits, suits + 4, std::greater<SuitRank>());
+
+    uint32_t key = static_cast<uint32_t>(suits[0].code << 15 | suits[1].code << 10 | suits[2].code << 5 | suits[3].code);
+    auto configuration = std::lower_bound(this->configurations_.begin(), this->configurations_.end(), key,
+                                          [](const Configuration& c, uint32_t k) { return c.key < k; });
+
+    // Suits of equal shape form a multiset of ranks i0 >= i1 >= ...; shifting
+    // them to i0 + m-1 > i1 + m-2 > ... turns it into a plain colex subset.
+    uint64_t result = configuration->offset;
+    for (int start = 0, end; start < 4; start = end) {
+        for (end = start + 1; end < 4 && suits[end].code == suits[start].code; ++end) {}
+        int count = end - start;
+        uint64_t groupRank = 0;
+        for (int j = 0; j < count; ++j) {
+            uint64_t shifted = suits[start + j].rank + count - 1 - j;
+            groupRank += smallBinomial(shifted, count - j);
+        }
+        result += groupRank * configuration->multipliers[start];
+    }
+    return result;
+}
+
+void HandIndexer::unindex(uint64_t index, CardSet& hole, CardSet& board) const {
+    auto configuration = std::upper_bound(this->configurations_.begin(), this->configurations_.end(), index,
+                                          [](uint64_t i, const Configuration& c) { return i < c.offset; }) - 1;
+
+    uint64_t remaining = index - configuration->offset;
+    uint64_t holeMask = 0, boardMask = 0;
+    for (int start = 0, end; start < 4; start = end) {
+        uint32_t code = (configuration->key >> (15 - 5 * start)) & 31;
+        for (end = start + 1; end < 4 && ((configuration->key >> (15 - 5 * end)) & 31) == code; ++end) {}
+        int count = end - start;
+        uint64_t groupSize = binomial(static_cast<int>(suitSpace(code)) + count - 1, count);
+        uint64_t groupRank = remaining % groupSize;
+        remaining /= groupSize;
+
+        uint64_t boardSpace = binomial(NUM_RANKS - shapeHole(code), shapeBoard(code));
+        for (int j = 0; j < count; ++j) {
+            int shifted = largestBinomialBelow(groupRank, count - j);
+            groupRank -= binomial(shifted, count - j);
+            uint64_t rank = static_cast<uint64_t>(shifted - (count - 1 - j));
+
+            int holeRanks = static_cast<int>(Combinatorics::colexUnrank(rank / boardSpace, shapeHole(code)));
+            int boardRanks = expandRanks(static_cast<int>(Combinatorics::colexUnrank(rank % boardSpace, shapeBoard(code))),
+                                         holeRanks);
+            int suit = start + j;
+            holeMask |= static_cast<uint64_t>(holeRanks) << (suit * 16);
+            boardMask |= static_cast<uint64_t>(boardRanks) << (suit * 16);
+        }
+    }
+    hole = CardSet(holeMask);
+    board = CardSet(boardMask);
+}
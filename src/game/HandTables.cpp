@@ -0,0 +1,253 @@
+#include "../../include/game/HandTables.h"
+#include "../../include/game/HandEvaluator.h"
+#include "../../include/core/Card.h"
+#include <algorithm>
+
+static const int RANK_COUNT = 13;
+
+// Scoring produces a sort key: the category times 13^5 plus the deciding
+// ranks as base-13 digits, this many of them per category.
+static const int KICKER_SPACE = 13 * 13 * 13 * 13 * 13;
+static const int KICKER_DIGITS[HAND_CATEGORIES] = {5, 4, 3, 3, 1, 5, 2, 2, 1, 0};
+
+const int HandTables::CATEGORY_FIRST_RANK[11] = {1, 1278, 4138, 4996, 5854, 5864, 7141, 7297, 7453, 7462, 7463};
+
+static int encodeKickers(const int* ranks, int count) {
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        value = value * RANK_COUNT + ranks[i];
+    }
+    return value;
+}
+
+static int topRanks(int rankMask, int* ranks, int count) {
+    int found = 0;
+    for (int r = RANK_COUNT - 1; r >= 0 && found < count; --r) {
+        if (rankMask & (1 << r)) {
+            ranks[found++] = r;
+        }
+    }
+    return found;
+}
+
+const HandTables& HandTables::instance() {
+    static const HandTables tables;
+    return tables;
+}
+
+HandTables::HandTables()
+    : rankKeys_(RANK_MASK_SIZE, 0), flushValues_(RANK_MASK_SIZE + 1, 0),
+      rankCountKeys_(HASH_SIZE, 0), rankCountValues_(HASH_SIZE + 1, 0),
+      handRankInfo_(NUM_HAND_RANKS + 1, HandRankInfo{0, 0, {0, 0, 0, 0, 0}}) {
+    uint32_t powers[RANK_COUNT];
+    uint32_t power = 1;
+    for (int r = 0; r < RANK_COUNT; ++r) {
+        powers[r] = power;
+        power *= 5;
+    }
+
+    std::vector<int> flushKeys(RANK_MASK_SIZE, 0);
+    for (int mask = 0; mask < RANK_MASK_SIZE; ++mask) {
+        uint32_t key = 0;
+        for (int r = 0; r < RANK_COUNT; ++r) {
+            if (mask & (1 << r)) key += powers[r];
+        }
+        this->rankKeys_[mask] = key;
+        flushKeys[mask] = scoreFlush(mask);
+    }
+
+    int counts[RANK_COUNT] = {0};
+    std::vector<int> rankCountKeys(HASH_SIZE, 0);
+    this->buildRankCountTable(counts, 0, 0, rankCountKeys);
+
+    // Every distinct sort key is one five-card hand class; its position
+    // among them is its dense rank.
+    std::vector<int> classes;
+    for (int key : flushKeys) {
+        if (key != 0) classes.push_back(key);
+    }
+    for (int key : rankCountKeys) {
+        if (key != 0) classes.push_back(key);
+    }
+    std::sort(classes.begin(), classes.end());
+    classes.erase(std::unique(classes.begin(), classes.end()), classes.end());
+
+    auto denseRank = [&classes](int key) {
+        return static_cast<uint16_t>(std::lower_bound(classes.begin(), classes.end(), key) - classes.begin() + 1);
+    };
+    for (int mask = 0; mask < RANK_MASK_SIZE; ++mask) {
+        if (flushKeys[mask] != 0) this->flushValues_[mask] = denseRank(flushKeys[mask]);
+    }
+    for (int slot = 0; slot < HASH_SIZE; ++slot) {
+        if (rankCountKeys[slot] != 0) this->rankCountValues_[slot] = denseRank(rankCountKeys[slot]);
+    }
+
+    for (size_t i = 0; i < classes.size() && i < NUM_HAND_RANKS; ++i) {
+        HandRankInfo& info = this->handRankInfo_[i + 1];
+        info.category = static_cast<uint8_t>(classes[i] / KICKER_SPACE);
+        info.numRanks = static_cast<uint8_t>(KICKER_DIGITS[info.category]);
+        int digits = classes[i] % KICKER_SPACE;
+        for (int j = info.numRanks - 1; j >= 0; --j) {
+            info.ranks[j] = static_cast<uint8_t>(digits % RANK_COUNT + RANK_TWO);
+            digits /= RANK_COUNT;
+        }
+    }
+    if (this->handRankInfo_[NUM_HAND_RANKS].category == HAND_ROYAL_FLUSH) {
+        HandRankInfo& royal = this->handRankInfo_[NUM_HAND_RANKS];
+        royal.numRanks = 1;
+        royal.ranks[0] = RANK_ACE;
+    }
+
+    this->batchKernel_ = hasAvx2() ? &HandTables::evaluateBatchAvx2 : &HandTables::evaluateBatchScalar;
+}
+
+void HandTables::buildRankCountTable(int counts[13], int rank, int total, std::vector<int>& sortKeys) {
+    if (rank == RANK_COUNT) {
+        if (total < 5) return;
+
+        uint32_t key = 0;
+        for (int r = RANK_COUNT - 1; r >= 0; --r) {
+            key = key * 5 + counts[r];
+        }
+
+        uint32_t slot = hashSlot(key);
+        while (this->rankCountKeys_[slot] != 0) {
+            slot = (slot + 1) & (HASH_SIZE - 1);
+        }
+        this->rankCountKeys_[slot] = key;
+        sortKeys[slot] = scoreRankCounts(counts);
+        return;
+    }
+
+    for (int c = 0; c <= 4 && total + c <= 7; ++c) {
+        counts[rank] = c;
+        this->buildRankCountTable(counts, rank + 1, total + c, sortKeys);
+    }
+    counts[rank] = 0;
+}
+
+int HandTables::straightHigh(int rankMask) {
+    for (int high = RANK_COUNT - 1; high >= 4; --high) {
+        int window = 0x1F << (high - 4);
+        if ((rankMask & window) == window) {
+            return high;
+        }
+    }
+    int wheel = (1 << (RANK_ACE - RANK_TWO)) | 0xF;
+    if ((rankMask & wheel) == wheel) {
+        return RANK_FIVE - RANK_TWO;
+    }
+    return -1;
+}
+
+int HandTables::scoreFlush(int rankMask) {
+    if (__builtin_popcount(rankMask) < 5) {
+        return 0;
+    }
+
+    int high = straightHigh(rankMask);
+    if (high == RANK_ACE - RANK_TWO) {
+        return HAND_ROYAL_FLUSH * KICKER_SPACE;
+    }
+    if (high >= 0) {
+        return HAND_STRAIGHT_FLUSH * KICKER_SPACE + high;
+    }
+
+    int ranks[5];
+    topRanks(rankMask, ranks, 5);
+    return HAND_FLUSH * KICKER_SPACE + encodeKickers(ranks, 5);
+}
+
+int HandTables::scoreRankCounts(const int counts[13]) {
+    int present = 0;
+    int quads = -1;
+    int trips[2] = {-1, -1};
+    int pairs[3] = {-1, -1, -1};
+    int numTrips = 0, numPairs = 0;
+
+    for (int r = RANK_COUNT - 1; r >= 0; --r) {
+        if (counts[r] == 0) continue;
+        present |= 1 << r;
+        if (counts[r] == 4 && quads < 0) quads = r;
+        else if (counts[r] == 3 && numTrips < 2) trips[numTrips++] = r;
+        else if (counts[r] == 2 && numPairs < 3) pairs[numPairs++] = r;
+    }
+
+    int kickers[5] = {0, 0, 0, 0, 0};
+
+    if (quads >= 0) {
+        topRanks(present & ~(1 << quads), kickers, 1);
+        return HAND_FOUR_OF_A_KIND * KICKER_SPACE + quads * RANK_COUNT + kickers[0];
+    }
+
+    if (numTrips > 0 && (numTrips > 1 || numPairs > 0)) {
+        int pairRank = numTrips > 1 ? trips[1] : -1;
+        if (numPairs > 0 && pairs[0] > pairRank) pairRank = pairs[0];
+        return HAND_FULL_HOUSE * KICKER_SPACE + trips[0] * RANK_COUNT + pairRank;
+    }
+
+    int high = straightHigh(present);
+    if (high >= 0) {
+        return HAND_STRAIGHT * KICKER_SPACE + high;
+    }
+
+    if (numTrips > 0) {
+        kickers[0] = trips[0];
+        topRanks(present & ~(1 << trips[0]), kickers + 1, 2);
+        return HAND_THREE_OF_A_KIND * KICKER_SPACE + encodeKickers(kickers, 3);
+    }
+
+    if (numPairs > 1) {
+        kickers[0] = pairs[0];
+        kickers[1] = pairs[1];
+        topRanks(present & ~(1 << pairs[0]) & ~(1 << pairs[1]), kickers + 2, 1);
+        return HAND_TWO_PAIR * KICKER_SPACE + encodeKickers(kickers, 3);
+    }
+
+    if (numPairs == 1) {
+        kickers[0] = pairs[0];
+        topRanks(present & ~(1 << pairs[0]), kickers + 1, 3);
+        return HAND_ONE_PAIR * KICKER_SPACE + encodeKickers(kickers, 4);
+    }
+
+    topRanks(present, kickers, 5);
+    return HAND_HIGH_CARD * KICKER_SPACE + encodeKickers(kickers, 5);
+}
+
+int HandTables::rankCountValue(uint32_t key) const {
+    uint32_t slot = hashSlot(key);
+    while (true) {
+        uint32_t entryKey = this->rankCountKeys_[slot];
+        if (entryKey == key) return this->rankCountValues_[slot];
+        if (entryKey == 0) return 0;
+        slot = (slot + 1) & (HASH_SIZE - 1);
+    }
+}
+
+int HandTables::evaluate(const int suitMasks[4]) const {
+    uint32_t key = this->rankKeys_[suitMasks[0]] + this->rankKeys_[suitMasks[1]] +
+                   this->rankKeys_[suitMasks[2]] + this->rankKeys_[suitMasks[3]];
+    return this->evaluate(key, suitMasks);
+}
+
+int HandTables::evaluate(uint32_t key, const int suitMasks[4]) const {
+    for (int suit = 0; suit < 4; ++suit) {
+        int flush = this->flushValues_[suitMasks[suit]];
+        if (flush != 0) {
+            int value = this->rankCountValue(key);
+            return flush > value ? flush : value;
+        }
+    }
+    return this->rankCountValue(key);
+}
+
+int HandTables::evaluate(CardSet cards) const {
+    int suitMasks[4] = {cards.suitMask(0), cards.suitMask(1), cards.suitMask(2), cards.suitMask(3)};
+    return this->evaluate(suitMasks);
+}
+
+void HandTables::evaluateBatchScalar(const uint64_t* masks, int32_t* values, int count) const {
+    for (int i = 0; i < count; ++i) {
+        values[i] = this->evaluate(CardSet(masks[i]));
+    }
+}
@@ -0,0 +1,82 @@
+#include "../../include/game/HandTables.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+bool HandTables::hasAvx2() {
+    return __builtin_cpu_supports("avx2");
+}
+
+// Low 13 bits of each 64-bit lane of lo/hi, shifted by the suit's lane
+// offset, packed into eight 32-bit lanes.
+__attribute__((target("avx2")))
+static __m256i suitLanes(__m256i lo, __m256i hi, int suit) {
+    const __m256i rankBits = _mm256_set1_epi64x(0x1FFF);
+    const __m256i packLow = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    __m256i a = _mm256_and_si256(_mm256_srli_epi64(lo, suit * 16), rankBits);
+    __m256i b = _mm256_and_si256(_mm256_srli_epi64(hi, suit * 16), rankBits);
+    a = _mm256_permutevar8x32_epi32(a, packLow);
+    b = _mm256_permutevar8x32_epi32(b, packLow);
+    return _mm256_blend_epi32(a, b, 0xF0);
+}
+
+__attribute__((target("avx2")))
+void HandTables::evaluateBatchAvx2(const uint64_t* masks, int32_t* values, int count) const {
+    const int* rankKeys = reinterpret_cast<const int*>(this->rankKeys_.data());
+    // 16-bit tables are gathered as 32-bit reads at a 2-byte stride and
+    // masked down; the spare slot at their end keeps the last read in bounds.
+    const int* flushValues = reinterpret_cast<const int*>(this->flushValues_.data());
+    const int* entryKeys = reinterpret_cast<const int*>(this->rankCountKeys_.data());
+    const int* entryValues = reinterpret_cast<const int*>(this->rankCountValues_.data());
+    const __m256i hashMultiplier = _mm256_set1_epi32(static_cast<int>(2654435761u));
+    const __m256i lowHalf = _mm256_set1_epi32(0xFFFF);
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + i));
+        __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + i + 4));
+
+        __m256i key = _mm256_setzero_si256();
+        __m256i flush = _mm256_setzero_si256();
+        for (int suit = 0; suit < 4; ++suit) {
+            __m256i suitMask = suitLanes(lo, hi, suit);
+            key = _mm256_add_epi32(key, _mm256_i32gather_epi32(rankKeys, suitMask, 4));
+            flush = _mm256_max_epi32(flush, _mm256_and_si256(_mm256_i32gather_epi32(flushValues, suitMask, 2), lowHalf));
+        }
+
+        // First probe of the rank-count hash; lanes that collided are
+        // finished by the scalar probe loop below.
+        __m256i slot = _mm256_srli_epi32(_mm256_mullo_epi32(key, hashMultiplier), 32 - HASH_BITS);
+        __m256i entryKey = _mm256_i32gather_epi32(entryKeys, slot, 4);
+        __m256i entryValue = _mm256_and_si256(_mm256_i32gather_epi32(entryValues, slot, 2), lowHalf);
+        __m256i result = _mm256_max_epi32(flush, entryValue);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), result);
+
+        int hits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(entryKey, key)));
+        if (hits != 0xFF) {
+            alignas(32) uint32_t keys[8];
+            alignas(32) int32_t flushes[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(keys), key);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(flushes), flush);
+            for (int lane = 0; lane < 8; ++lane) {
+                if (hits & (1 << lane)) continue;
+                int value = this->rankCountValue(keys[lane]);
+                values[i + lane] = flushes[lane] > value ? flushes[lane] : value;
+            }
+        }
+    }
+
+    this->evaluateBatchScalar(masks + i, values + i, count - i);
+}
+
+#else
+
+bool HandTables::hasAvx2() {
+    return false;
+}
+
+void HandTables::evaluateBatchAvx2(const uint64_t* masks, int32_t* values, int count) const {
+    this->evaluateBatchScalar(masks, values, count);
+}
+
+#endif
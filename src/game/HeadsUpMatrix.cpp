@@ -0,0 +1,110 @@
+#include "../../include/game/HeadsUpMatrix.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+CardSet HeadsUpMatrix::comboCards(int combo) {
+    int high = 1;
+    while ((high + 1) * high / 2 <= combo) {
+        high++;
+    }
+    int low = combo - high * (high - 1) / 2;
+    return CardSet(Card::fromIndex(high).getBit() | Card::fromIndex(low).getBit());
+}
+
+HeadsUpMatrix::~HeadsUpMatrix() {
+    this->unload();
+}
+
+bool HeadsUpMatrix::load(const std::string& path) {
+    this->unload();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    size_t expected = sizeof(FileHeader) + sizeof(uint16_t) * NUM_COMBOS * NUM_COMBOS;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) != expected) {
+        close(fd);
+        return false;
+    }
+
+    void* mapping = mmap(nullptr, expected, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+
+    const FileHeader* header = static_cast<const FileHeader*>(mapping);
+    if (header->magic != FILE_MAGIC || header->version != FILE_VERSION ||
+        header->numCombos != NUM_COMBOS || header->scale != EQUITY_SCALE) {
+        munmap(mapping, expected);
+        return false;
+    }
+
+    this->mapping_ = mapping;
+    this->mappingSize_ = expected;
+    this->values_ = reinterpret_cast<const uint16_t*>(static_cast<const char*>(mapping) + sizeof(FileHeader));
+    return true;
+}
+
+void HeadsUpMatrix::unload() {
+    if (this->mapping_) {
+        munmap(this->mapping_, this->mappingSize_);
+    }
+    this->mapping_ = nullptr;
+    this->mappingSize_ = 0;
+    this->values_ = nullptr;
+}
+
+float HeadsUpMatrix::comboVsRange(int heroCombo, const std::vector<float>& villainWeights) const {
+    std::vector<float> heroWeights(NUM_COMBOS, 0.0f);
+    heroWeights[heroCombo] = 1.0f;
+    return this->rangeVsRange(heroWeights, villainWeights);
+}
+
+float HeadsUpMatrix::rangeVsRange(const std::vector<float>& heroWeights,
+                                  const std::vector<float>& villainWeights) const {
+    if (!this->isLoaded() || heroWeights.size() != NUM_COMBOS || villainWeights.size() != NUM_COMBOS) {
+        return 0.0f;
+    }
+
+    // Weight of villain combos blocked by each card, so a hero combo's
+    // non-conflicting villain weight needs no extra pass over the row.
+    double cardWeights[Card::NUM_CARDS] = {0.0};
+    double totalWeight = 0.0;
+    for (int j = 0; j < NUM_COMBOS; ++j) {
+        if (villainWeights[j] == 0.0f) continue;
+        for (Card card : comboCards(j)) {
+            cardWeights[card.getIndex()] += villainWeights[j];
+        }
+        totalWeight += villainWeights[j];
+    }
+
+    double equity = 0.0;
+    double weight = 0.0;
+    for (int i = 0; i < NUM_COMBOS; ++i) {
+        float heroWeight = heroWeights[i];
+        if (heroWeight == 0.0f) continue;
+
+        const uint16_t* values = this->row(i);
+        double dot = 0.0;
+        for (int j = 0; j < NUM_COMBOS; ++j) {
+            dot += villainWeights[j] * values[j];
+        }
+
+        double live = totalWeight + villainWeights[i];
+        for (Card card : comboCards(i)) {
+            live -= cardWeights[card.getIndex()];
+        }
+
+        equity += heroWeight * dot / EQUITY_SCALE;
+        weight += heroWeight * live;
+    }
+
+    if (weight <= 0.0) return 0.0f;
+    return static_cast<float>(equity / weight);
+}
@@ -2,17 +2,33 @@
 #include "../../include/players/HumanPlayer.h"
 #include "../../include/players/BotPlayer.h"
 #include <algorithm>
-#include <random>
 #include <chrono>
 
 PokerGame::PokerGame(std::shared_ptr<IGameView> view)
     : view(view), evaluator(std::make_shared<HandEvaluator>()), 
       deck(std::make_unique<Deck>()), gameRunning(false) {
+    this->seedStreams();
 }
 
 PokerGame::PokerGame(std::shared_ptr<IGameView> view,  GameSettings& settings)
     : view(view), evaluator(std::make_shared<HandEvaluator>()), 
       deck(std::make_unique<Deck>()), gameRunning(false), settings(settings) {
+    this->seedStreams();
+}
+
+PokerGame::PokerGame(std::shared_ptr<IGameView> view,  GameSettings& settings, std::shared_ptr<IHandEvaluator> evaluator)
+    : view(view), evaluator(evaluator), 
+      deck(std::make_unique<Deck>()), gameRunning(false), settings(settings) {
+    this->seedStreams();
+}
+
+void PokerGame::seedStreams() {
+    if (this->settings.seed == 0) {
+        this->settings.seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+    this->deck->seed(FastRandom::streamSeed(this->settings.seed, STREAM_DECK));
+    this->rng.seed(FastRandom::streamSeed(this->settings.seed, STREAM_GAME));
+    this->evaluator->seed(FastRandom::streamSeed(this->settings.seed, STREAM_EQUITY));
 }
 
 void PokerGame::initialize() {
@@ -25,122 +41,148 @@ void PokerGame::initialize() {
 void PokerGame::setupPlayers() {
     this->players.clear();
     
-    auto humanPlayer = std::make_shared<HumanPlayer>("Player", this->settings.startingBalance, this->view);
-    this->players.push_back(humanPlayer);
+    if (this->settings.humanPlayer) {
+        auto humanPlayer = std::make_shared<HumanPlayer>("Player", this->view);
+        this->players.push_back(humanPlayer);
+    }
     
+    int freeSeats = SeatTable::MAX_SEATS - static_cast<int>(this->players.size());
+    if (this->settings.numBots > freeSeats) {
+        this->view->displayMessage("Only " + std::to_string(freeSeats) + " bots fit at the table; " +
+                                   std::to_string(this->settings.numBots - freeSeats) + " will not be seated.");
+        this->settings.numBots = freeSeats;
+    }
     for (int i = 1; i <= this->settings.numBots; ++i) {
         std::string botName = "Bot" + std::to_string(i);
-        auto bot = std::make_shared<BotPlayer>(botName, this->settings.startingBalance, this->settings.difficulty);
+        int difficulty = i <= static_cast<int>(this->settings.botDifficulties.size())
+            ? this->settings.botDifficulties[i - 1] : this->settings.difficulty;
+        auto bot = std::make_shared<BotPlayer>(botName, difficulty,
+                                               FastRandom::streamSeed(this->settings.seed, STREAM_BOTS + i));
         this->players.push_back(bot);
     }
+    
+    SeatTable& seats = this->state.seats;
+    seats.count = static_cast<int>(this->players.size());
+    for (int seat = 0; seat < SeatTable::MAX_SEATS; ++seat) {
+        bool seated = seat < seats.count;
+        seats.names[seat] = seated ? this->players[seat]->getName() : std::string();
+        seats.balance[seat] = seated ? this->settings.startingBalance : 0;
+        seats.currentBet[seat] = 0;
+        seats.hand[seat].clear();
+        seats.active[seat] = seated;
+    }
 }
 
 void PokerGame::dealCards() {
     this->deck->reset();
-    this->deck->shuffle();
     
-    for (auto& player : this->players) {
-        player->clearHand();
+    SeatTable& seats = this->state.seats;
+    for (int seat = 0; seat < seats.count; ++seat) {
+        seats.hand[seat].clear();
     }
     
     for (int i = 0; i < 2; ++i) {
-        for (auto& player : this->players) {
-            if (player->getBalance() > 0) {
-                player->receiveCard(this->deck->draw());
+        for (int seat = 0; seat < seats.count; ++seat) {
+            if (seats.balance[seat] > 0) {
+                seats.hand[seat].insert(this->deck->draw());
             }
         }
     }
 }
 
 void PokerGame::postBlinds() {
-    for (auto& player : this->players) {
-        player->resetCurrentBet();
-        player->setActive(true);
+    SeatTable& seats = this->state.seats;
+    // Seats that were not dealt in have no chips left and sit the hand out.
+    for (int seat = 0; seat < seats.count; ++seat) {
+        seats.currentBet[seat] = 0;
+        seats.active[seat] = seats.hand[seat].size() == 2;
     }
     
     this->state.currentBet = 0;
     this->state.pot = 0;
+    this->state.smallBlind = this->settings.smallBlind;
     
-    int sbIndex = (this->state.dealerPosition + 1) % this->players.size();
-    int sbAmount = std::min(this->settings.smallBlind, this->players[sbIndex]->getBalance());
-    this->players[sbIndex]->removeChips(sbAmount);
-    this->players[sbIndex]->setCurrentBet(sbAmount);
+    // Blinds pass over seats that have no chips left.
+    int sbIndex = this->getNextActivePlayer((this->state.dealerPosition + 1) % seats.count);
+    if (sbIndex == -1) return;
+    int sbAmount = std::min(this->settings.smallBlind, seats.balance[sbIndex]);
+    seats.balance[sbIndex] -= sbAmount;
+    seats.currentBet[sbIndex] = sbAmount;
     this->state.pot += sbAmount;
     
-    int bbIndex = (this->state.dealerPosition + 2) % this->players.size();
-    int bbAmount = std::min(this->settings.smallBlind * 2, this->players[bbIndex]->getBalance());
-    this->players[bbIndex]->removeChips(bbAmount);
-    this->players[bbIndex]->setCurrentBet(bbAmount);
-    this->state.currentBet = bbAmount;
+    int bbIndex = this->getNextActivePlayer((sbIndex + 1) % seats.count);
+    if (bbIndex == sbIndex) {
+        this->state.currentBet = sbAmount;
+        return;
+    }
+    int bbAmount = std::min(this->settings.smallBlind * 2, seats.balance[bbIndex]);
+    seats.balance[bbIndex] -= bbAmount;
+    seats.currentBet[bbIndex] = bbAmount;
+    this->state.currentBet = std::max(sbAmount, bbAmount);
     this->state.pot += bbAmount;
 }
 
 void PokerGame::bettingRound() {
-    int startIndex = (this->state.dealerPosition + 3) % this->players.size();
-    int currentIndex = startIndex;
-    int lastRaiseIndex = -1;
+    SeatTable& seats = this->state.seats;
+    int offset = this->state.communityCards.empty() ? 3 : 1;
+    int currentIndex = (this->state.dealerPosition + offset) % seats.count;
     int raisesInRound = 0;
  int maxRaises = 3;
+    bool acted[SeatTable::MAX_SEATS] = {};
     
+    // The street ends once everyone who still has chips has acted and
+    // matched the bet, or one player is left in the hand.
     while (true) {
-        currentIndex = this->getNextActivePlayer(currentIndex);
-        if (currentIndex == -1) break;
-        
-        auto player = this->players[currentIndex];
-        
-        if (player->getBalance() == 0 && player->getCurrentBet() == this->state.currentBet) {
-            currentIndex = (currentIndex + 1) % this->players.size();
-            if (currentIndex == startIndex) break;
-            continue;
+        int inHand = 0;
+        bool everyoneActed = true;
+        for (int i = 0; i < seats.count; ++i) {
+            if (!seats.inHand(i)) continue;
+            inHand++;
+            if (seats.balance[i] > 0 && !acted[i]) everyoneActed = false;
         }
+        if (inHand <= 1 || (everyoneActed && this->allPlayersActed())) break;
         
-        if (this->allPlayersActed() && currentIndex == startIndex && lastRaiseIndex == -1) {
-            break;
-        }
-        
-        if (player->getCurrentBet() == this->state.currentBet && 
-            (lastRaiseIndex == -1 || currentIndex == lastRaiseIndex)) {
-            if (this->allPlayersActed()) break;
-        }
+        currentIndex = this->getNextActivePlayer(currentIndex);
+        if (currentIndex == -1) break;
         
         this->state.currentPlayerIndex = currentIndex;
         this->updateGameState();
         this->view->displayGameState(this->state);
         
-        Action action = player->makeDecision(this->state);
-        this->processAction(player, action);
-        
+        Action action = this->players[currentIndex]->makeDecision(this->state);
         if (action.type == ACTION_RAISE || action.type == ACTION_BET) {
             if (raisesInRound < maxRaises) {
-                lastRaiseIndex = currentIndex;
                 raisesInRound++;
-                startIndex = currentIndex;
+            } else {
+                action.type = ACTION_CALL;
             }
         }
+        this->processAction(currentIndex, action);
+        acted[currentIndex] = true;
         
-        currentIndex = (currentIndex + 1) % this->players.size();
-        if (currentIndex == startIndex && lastRaiseIndex == -1) {
-            if (this->allPlayersActed()) break;
-        }
+        currentIndex = (currentIndex + 1) % seats.count;
     }
     
-    for (auto& player : this->players) {
-        this->state.pot += player->getCurrentBet();
-        player->resetCurrentBet();
+    // Bets went into the pot as they were made; only the street's bets reset.
+    for (int seat = 0; seat < seats.count; ++seat) {
+        seats.currentBet[seat] = 0;
     }
+    this->state.currentBet = 0;
 }
 
 void PokerGame::revealCommunityCards(int count) {
-    for (int i = 0; i < count; ++i) {
-        if (!this->deck->isEmpty()) {
-            this->state.communityCards.push_back(this->deck->draw());
-        }
+    Card cards[5];
+    int drawn = this->deck->drawN(cards, std::min(count, 5));
+    for (int i = 0; i < drawn; ++i) {
+        this->state.communityCards.push_back(cards[i]);
+        this->state.communitySet.insert(cards[i]);
     }
 }
 
 void PokerGame::playRound() {
     this->state.communityCards.clear();
-    this->state.dealerPosition = (this->state.dealerPosition + 1) % this->players.size();
+    this->state.communitySet.clear();
+    this->state.dealerPosition = (this->state.dealerPosition + 1) % this->state.seats.count;
     this->state.currentPlayerIndex = 0;
     
     this->dealCards();
@@ -152,11 +194,11 @@ void PokerGame::playRound() {
     this->bettingRound();
     
     int activeCount = 0;
-    for (auto& player : this->players) {
-        if (player->isActive() && player->getBalance() > 0) activeCount++;
+    for (int seat = 0; seat < this->state.seats.count; ++seat) {
+        if (this->state.seats.canAct(seat)) activeCount++;
     }
     if (activeCount <= 1) {
-        this->determineWinner();
+        this->finishHand();
         return;
     }
     
@@ -166,11 +208,11 @@ void PokerGame::playRound() {
     this->bettingRound();
     
     activeCount = 0;
-    for (auto& player : this->players) {
-        if (player->isActive() && player->getBalance() > 0) activeCount++;
+    for (int seat = 0; seat < this->state.seats.count; ++seat) {
+        if (this->state.seats.canAct(seat)) activeCount++;
     }
     if (activeCount <= 1) {
-        this->determineWinner();
+        this->finishHand();
         return;
     }
     
@@ -180,11 +222,11 @@ void PokerGame::playRound() {
     this->bettingRound();
     
     activeCount = 0;
-    for (auto& player : this->players) {
-        if (player->isActive() && player->getBalance() > 0) activeCount++;
+    for (int seat = 0; seat < this->state.seats.count; ++seat) {
+        if (this->state.seats.canAct(seat)) activeCount++;
     }
     if (activeCount <= 1) {
-        this->determineWinner();
+        this->finishHand();
         return;
     }
     
@@ -196,6 +238,20 @@ void PokerGame::playRound() {
     this->showdown();
 }
 
+void PokerGame::finishHand() {
+    int inHand = 0;
+    for (int seat = 0; seat < this->state.seats.count; ++seat) {
+        if (this->state.seats.inHand(seat)) inHand++;
+    }
+    // Players all-in still contest the pot, so the board is dealt out first.
+    if (inHand > 1) {
+        this->revealCommunityCards(5 - this->state.communityCards.size());
+        this->updateGameState();
+        this->view->displayGameState(this->state);
+    }
+    this->determineWinner();
+}
+
 void PokerGame::showdown() {
     this->view->displayMessage("Showdown! Revealing all cards...");
     this->view->waitForInput();
@@ -204,62 +260,73 @@ void PokerGame::showdown() {
 }
 
 void PokerGame::determineWinner() {
-    std::vector<std::shared_ptr<IPlayer>> activePlayers;
-    for (auto& player : this->players) {
-        if (player->isActive() && player->getBalance() >= 0) {
-            activePlayers.push_back(player);
+    SeatTable& seats = this->state.seats;
+    int activeSeats[SeatTable::MAX_SEATS];
+    int numActive = 0;
+    for (int seat = 0; seat < seats.count; ++seat) {
+        if (seats.active[seat] && seats.balance[seat] >= 0) {
+            activeSeats[numActive++] = seat;
         }
     }
     
-    if (activePlayers.empty()) {
+    if (numActive == 0) {
         this->view->displayMessage("No active players!");
         return;
     }
     
-    if (activePlayers.size() == 1) {
-        activePlayers[0]->addChips(this->state.pot);
-        this->view->displayMessage(activePlayers[0]->getName() + " wins $" + std::to_string(this->state.pot) + "!");
+    if (numActive == 1) {
+        seats.balance[activeSeats[0]] += this->state.pot;
+        this->view->displayMessage(seats.names[activeSeats[0]] + " wins $" + std::to_string(this->state.pot) + "!");
     } else {
         int bestHandValue = -1;
-        std::vector<size_t> winners;
+        int winners[SeatTable::MAX_SEATS];
+        int numWinners = 0;
         
-        for (size_t i = 0; i < activePlayers.size(); ++i) {
-            auto hand = activePlayers[i]->getHand();
+        CardSet hands[SeatTable::MAX_SEATS];
+        int handSeats[SeatTable::MAX_SEATS];
+        int numHands = 0;
+        for (int i = 0; i < numActive; ++i) {
+            CardSet hand = seats.hand[activeSeats[i]];
             if (hand.size() == 2) {
-                int handValue = this->evaluator->evaluateBestHand(hand, this->state.communityCards);
-                
-                if (handValue > bestHandValue) {
-                    bestHandValue = handValue;
-                    winners.clear();
-                    winners.push_back(i);
-                } else if (handValue == bestHandValue) {
-                    winners.push_back(i);
-                }
+                hands[numHands] = hand | this->state.communitySet;
+                handSeats[numHands++] = activeSeats[i];
             }
         }
         
-        if (winners.empty()) {
-            std::mt19937 rng(std::chrono::steady_clock::now().time_since_epoch().count());
-            std::uniform_int_distribution<size_t> dist(0, activePlayers.size() - 1);
-            size_t winnerIndex = dist(rng);
-            activePlayers[winnerIndex]->addChips(this->state.pot);
-            this->view->displayMessage(activePlayers[winnerIndex]->getName() + " wins $" + std::to_string(this->state.pot) + "!");
+        int32_t handValues[SeatTable::MAX_SEATS];
+        this->evaluator->evaluateBatch(hands, handValues, numHands);
+        
+        for (int k = 0; k < numHands; ++k) {
+            int handValue = handValues[k];
+            if (handValue > bestHandValue) {
+                bestHandValue = handValue;
+                numWinners = 0;
+                winners[numWinners++] = handSeats[k];
+            } else if (handValue == bestHandValue) {
+                winners[numWinners++] = handSeats[k];
+            }
+        }
+        
+        if (numWinners == 0) {
+            int winner = activeSeats[this->rng.nextBelow(static_cast<uint32_t>(numActive))];
+            seats.balance[winner] += this->state.pot;
+            this->view->displayMessage(seats.names[winner] + " wins $" + std::to_string(this->state.pot) + "!");
         } else {
-            int potPerWinner = this->state.pot / winners.size();
-            int remainder = this->state.pot % winners.size();
+            int potPerWinner = this->state.pot / numWinners;
+            int remainder = this->state.pot % numWinners;
             
-            for (size_t i = 0; i < winners.size(); ++i) {
+            for (int i = 0; i < numWinners; ++i) {
                 int winnings = potPerWinner + (i < remainder ? 1 : 0);
-                activePlayers[winners[i]]->addChips(winnings);
+                seats.balance[winners[i]] += winnings;
             }
             
-            if (winners.size() == 1) {
-                this->view->displayMessage(activePlayers[winners[0]]->getName() + " wins $" + std::to_string(this->state.pot) + "!");
+            if (numWinners == 1) {
+                this->view->displayMessage(seats.names[winners[0]] + " wins $" + std::to_string(this->state.pot) + "!");
             } else {
                 std::string winnerNames;
-                for (size_t i = 0; i < winners.size(); ++i) {
-                    if (i > 0) winnerNames += (i == winners.size() - 1 ? " and " : ", ");
-                    winnerNames += activePlayers[winners[i]]->getName();
+                for (int i = 0; i < numWinners; ++i) {
+                    if (i > 0) winnerNames += (i == numWinners - 1 ? " and " : ", ");
+                    winnerNames += seats.names[winners[i]];
                 }
                 this->view->displayMessage(winnerNames + " tie and split $" + std::to_string(this->state.pot) + "!");
             }
@@ -272,25 +339,30 @@ void PokerGame::determineWinner() {
 
 void PokerGame::resetRound() {
     this->state.communityCards.clear();
+    this->state.communitySet.clear();
     this->state.currentBet = 0;
     this->state.pot = 0;
     this->state.currentPlayerIndex = 0;
     this->state.winChance = std::nullopt;
     this->state.outs = std::nullopt;
+    this->state.trueOuts = std::nullopt;
+    this->state.drawOdds = std::nullopt;
     
-    for (auto& player : this->players) {
-        player->clearHand();
-        player->resetCurrentBet();
-        player->setActive(true);
+    SeatTable& seats = this->state.seats;
+    for (int seat = 0; seat < seats.count; ++seat) {
+        seats.hand[seat].clear();
+        seats.currentBet[seat] = 0;
+        seats.active[seat] = true;
     }
     
     this->updateGameState();
 }
 
 int PokerGame::getNextActivePlayer(int startIndex)  {
-    for (int i = 0; i < this->players.size(); ++i) {
-        int index = (startIndex + i) % this->players.size();
-        if (this->players[index]->isActive() && this->players[index]->getBalance() > 0) {
+    const SeatTable& seats = this->state.seats;
+    for (int i = 0; i < seats.count; ++i) {
+        int index = (startIndex + i) % seats.count;
+        if (seats.canAct(index)) {
             return index;
         }
     }
@@ -298,44 +370,53 @@ int PokerGame::getNextActivePlayer(int startIndex)  {
 }
 
 bool PokerGame::allPlayersActed()  {
-    for ( auto& player : this->players) {
-        if (player->isActive() && player->getBalance() > 0) {
-            if (player->getCurrentBet() != this->state.currentBet) {
-                return false;
-            }
+    const SeatTable& seats = this->state.seats;
+    for (int seat = 0; seat < seats.count; ++seat) {
+        if (seats.canAct(seat) && seats.currentBet[seat] != this->state.currentBet) {
+            return false;
         }
     }
     return true;
 }
 
-void PokerGame::processAction(std::shared_ptr<IPlayer> player,  Action& action) {
-    this->processAction(player, action, true);
+void PokerGame::processAction(int seat,  Action& action) {
+    this->processAction(seat, action, true);
 }
 
-void PokerGame::processAction(std::shared_ptr<IPlayer> player,  Action& action, bool verbose) {
+void PokerGame::processAction(int seat,  Action& action, bool verbose) {
+    SeatTable& seats = this->state.seats;
+    const std::string& name = seats.names[seat];
     switch (action.type) {
         case ACTION_FOLD:
-            player->setActive(false);
+            seats.active[seat] = false;
             if (verbose) {
-                this->view->displayMessage(player->getName() + " folds.");
+                this->view->displayMessage(name + " folds.");
             }
             break;
             
         case ACTION_CHECK:
+            // As for the human seat, checking while facing a bet folds.
+            if (seats.currentBet[seat] < this->state.currentBet && seats.balance[seat] > 0) {
+                seats.active[seat] = false;
+                if (verbose) {
+                    this->view->displayMessage(name + " folds.");
+                }
+                break;
+            }
             if (verbose) {
-                this->view->displayMessage(player->getName() + " checks.");
+                this->view->displayMessage(name + " checks.");
             }
             break;
             
         case ACTION_CALL: {
-            int callAmount = this->state.currentBet - player->getCurrentBet();
+            int callAmount = this->state.currentBet - seats.currentBet[seat];
             if (callAmount > 0) {
-                int actualAmount = std::min(callAmount, player->getBalance());
-                player->removeChips(actualAmount);
-                player->setCurrentBet(player->getCurrentBet() + actualAmount);
+                int actualAmount = std::min(callAmount, seats.balance[seat]);
+                seats.balance[seat] -= actualAmount;
+                seats.currentBet[seat] += actualAmount;
                 this->state.pot += actualAmount;
                 if (verbose) {
-                    this->view->displayMessage(player->getName() + " calls $" + std::to_string(actualAmount) + ".");
+                    this->view->displayMessage(name + " calls $" + std::to_string(actualAmount) + ".");
                 }
             }
             break;
@@ -343,34 +424,34 @@ void PokerGame::processAction(std::shared_ptr<IPlayer> player,  Action& action,
         
         case ACTION_BET:
         case ACTION_RAISE: {
-            int totalBet = std::min(action.amount, player->getBalance() + player->getCurrentBet());
-            int currentPlayerBet = player->getCurrentBet();
+            int totalBet = std::min(action.amount, seats.balance[seat] + seats.currentBet[seat]);
+            int currentPlayerBet = seats.currentBet[seat];
             int additionalChips = totalBet - currentPlayerBet;
             
             if (additionalChips > 0) {
-                player->removeChips(additionalChips);
-                player->setCurrentBet(totalBet);
-                this->state.currentBet = totalBet;
+                seats.balance[seat] -= additionalChips;
+                seats.currentBet[seat] = totalBet;
+                this->state.currentBet = std::max(this->state.currentBet, totalBet);
                 this->state.pot += additionalChips;
                 
                 if (verbose) {
                     std::string actionStr = (action.type == ACTION_BET) ? "bets" : "raises";
-                    this->view->displayMessage(player->getName() + " " + actionStr + " to $" + std::to_string(totalBet) + ".");
+                    this->view->displayMessage(name + " " + actionStr + " to $" + std::to_string(totalBet) + ".");
                 }
             }
             break;
         }
         
         case ACTION_ALL_IN: {
-            int allInAmount = std::min(action.amount, player->getBalance());
-            player->removeChips(allInAmount);
-            player->setCurrentBet(player->getCurrentBet() + allInAmount);
-            if (player->getCurrentBet() > this->state.currentBet) {
-                this->state.currentBet = player->getCurrentBet();
+            int allInAmount = std::min(action.amount, seats.balance[seat]);
+            seats.balance[seat] -= allInAmount;
+            seats.currentBet[seat] += allInAmount;
+            if (seats.currentBet[seat] > this->state.currentBet) {
+                this->state.currentBet = seats.currentBet[seat];
             }
             this->state.pot += allInAmount;
             if (verbose) {
-                this->view->displayMessage(player->getName() + " goes all-in with $" + std::to_string(allInAmount) + "!");
+                this->view->displayMessage(name + " goes all-in with $" + std::to_string(allInAmount) + "!");
             }
             break;
         }
@@ -378,16 +459,16 @@ void PokerGame::processAction(std::shared_ptr<IPlayer> player,  Action& action,
 }
 
 void PokerGame::updateGameState() {
-    this->state.players = this->players;
     this->state.evaluator = this->evaluator;
     
-    if (this->players.size() > 0) {
-        auto playerHand = this->players[0]->getHand();
+    const SeatTable& seats = this->state.seats;
+    if (this->settings.humanPlayer && seats.count > 0) {
+        std::vector<Card> playerHand = seats.hand[0].toCards();
         
         if (this->settings.calculateWinChance && playerHand.size() == 2) {
             int numOpponents = 0;
-            for (size_t i = 1; i < this->players.size(); ++i) {
-                if (this->players[i]->isActive() && this->players[i]->getBalance() > 0) {
+            for (int i = 1; i < seats.count; ++i) {
+                if (seats.canAct(i)) {
                     numOpponents++;
                 }
             }
@@ -402,20 +483,40 @@ void PokerGame::updateGameState() {
         }
         
         if (this->settings.showOuts && playerHand.size() == 2 && !this->state.communityCards.empty()) {
+            // Outs and odds only treat the cards the player can see as dead.
             std::vector<std::vector<Card>> opponentHands;
-            for (size_t i = 1; i < this->players.size(); ++i) {
-                if (this->players[i]->isActive()) {
-                    opponentHands.push_back(this->players[i]->getHand());
+            if (this->settings.showOpponentCards) {
+                for (int i = 1; i < seats.count; ++i) {
+                    if (seats.active[i]) {
+                        opponentHands.push_back(seats.hand[i].toCards());
+                    }
                 }
             }
             
-            this->state.outs = this->evaluator->findOuts(
+            this->state.outs = this->evaluator->findOutsByCategory(
+                playerHand,
+                this->state.communityCards,
+                opponentHands
+            );
+            this->state.drawOdds = this->evaluator->calculateDrawOdds(
                 playerHand,
                 this->state.communityCards,
                 opponentHands
             );
+            
+            if (this->settings.showOpponentCards) {
+                this->state.trueOuts = this->evaluator->findTrueOuts(
+                    playerHand,
+                    this->state.communityCards,
+                    opponentHands
+                );
+            } else {
+                this->state.trueOuts = std::nullopt;
+            }
         } else {
             this->state.outs = std::nullopt;
+            this->state.trueOuts = std::nullopt;
+            this->state.drawOdds = std::nullopt;
         }
     }
 }
@@ -430,13 +531,7 @@ void PokerGame::run() {
     this->startGame();
     
     while (this->gameRunning) {
-        bool playerHasMoney = false;
-        for ( auto& player : this->players) {
-            if (player->getBalance() > 0) {
-                playerHasMoney = true;
-                break;
-            }
-        }
+        bool playerHasMoney = this->playersWithChips() > 0;
         
         if (!playerHasMoney) {
             this->view->displayMessage("Game over! No players have money left.");
@@ -446,7 +541,7 @@ void PokerGame::run() {
         this->playRound();
         this->resetRound();
         
-        if (this->players.size() > 0 && this->players[0]->getBalance() <= 0) {
+        if (this->state.seats.count > 0 && this->state.seats.balance[0] <= 0) {
             this->view->displayMessage("Кончились деньги, начните новую игру");
             this->view->waitForInput();
             this->gameRunning = false;
@@ -459,7 +554,7 @@ void PokerGame::run() {
         if (choice == 2) {
             this->gameRunning = false;
         } else {
-            if (this->players.size() > 0 && this->players[0]->getBalance() <= 0) {
+            if (this->state.seats.count > 0 && this->state.seats.balance[0] <= 0) {
                 this->view->displayMessage("Кончились деньги, начните новую игру");
                 this->view->waitForInput();
                 this->gameRunning = false;
@@ -472,3 +567,90 @@ void PokerGame::run() {
     }
 }
 
+int PokerGame::playersWithChips() {
+    int count = 0;
+    for (int seat = 0; seat < this->state.seats.count; ++seat) {
+        count += this->state.seats.balance[seat] > 0;
+    }
+    return count;
+}
+
+void PokerGame::beginSimulation(SimulationResult& result) {
+    this->settings.humanPlayer = false;
+    this->setupPlayers();
+    this->resetRound();
+    this->gameRunning = true;
+    
+    const SeatTable& seats = this->state.seats;
+    result.names.assign(seats.names, seats.names + seats.count);
+    result.netChips.assign(seats.count, 0);
+    result.tournamentWins.assign(seats.count, 0);
+}
+
+void PokerGame::playSimulatedRound(SimulationResult& result) {
+    const SeatTable& seats = this->state.seats;
+    int32_t before[SeatTable::MAX_SEATS];
+    std::copy(seats.balance, seats.balance + SeatTable::MAX_SEATS, before);
+    
+    this->playRound();
+    this->resetRound();
+    
+    for (int seat = 0; seat < seats.count; ++seat) {
+        result.netChips[seat] += seats.balance[seat] - before[seat];
+    }
+    result.hands++;
+}
+
+SimulationResult PokerGame::simulate(int hands) {
+    SimulationResult result;
+    this->beginSimulation(result);
+    auto start = std::chrono::steady_clock::now();
+    
+    SeatTable& seats = this->state.seats;
+    for (int hand = 0; hand < hands; ++hand) {
+        for (int seat = 0; seat < seats.count; ++seat) {
+            if (seats.balance[seat] <= 0) {
+                seats.balance[seat] = this->settings.startingBalance;
+            }
+        }
+        this->playSimulatedRound(result);
+    }
+    
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    this->gameRunning = false;
+    return result;
+}
+
+SimulationResult PokerGame::simulateTournaments(int tournaments) {
+    SimulationResult result;
+    this->beginSimulation(result);
+    auto start = std::chrono::steady_clock::now();
+    
+    SeatTable& seats = this->state.seats;
+    int smallBlind = this->settings.smallBlind;
+    for (int tournament = 0; tournament < tournaments; ++tournament) {
+        for (int seat = 0; seat < seats.count; ++seat) {
+            seats.balance[seat] = this->settings.startingBalance;
+        }
+        
+        this->settings.smallBlind = smallBlind;
+        for (int hand = 1; this->playersWithChips() > 1; ++hand) {
+            this->playSimulatedRound(result);
+            if (hand % TOURNAMENT_LEVEL_HANDS == 0) {
+                this->settings.smallBlind *= 2;
+            }
+        }
+        
+        for (int seat = 0; seat < seats.count; ++seat) {
+            if (seats.balance[seat] > 0) {
+                result.tournamentWins[seat]++;
+            }
+        }
+        result.tournaments++;
+    }
+    this->settings.smallBlind = smallBlind;
+    
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    this->gameRunning = false;
+    return result;
+}
@@ -0,0 +1,11 @@
+#include "../../include/game/PreflopTable.h"
+
+float PreflopTable::equity(int classIndex, int numOpponents) {
+    if (classIndex < 0 || classIndex >= NUM_CLASSES || numOpponents <= 0) {
+        return numOpponents <= 0 ? 1.0f : 0.0f;
+    }
+    if (numOpponents > MAX_OPPONENTS) {
+        numOpponents = MAX_OPPONENTS;
+    }
+    return PREFLOP_EQUITY[classIndex][numOpponents - 1] / static_cast<float>(EQUITY_SCALE);
+}
@@ -0,0 +1,176 @@
+// Generated by tools/PreflopTableGenerator.cpp; do not edit by hand.
+// Monte Carlo all-in equity, standard error <= 0.0005 per entry.
+
+#include "../../include/game/PreflopTable.h"
+
+const uint16_t PREFLOP_EQUITY[PreflopTable::NUM_CLASSES][PreflopTable::MAX_OPPONENTS] = {
+    {32958, 20064, 14378, 11608, 10196,  9274,  8727,  8205,  7859},
+    {21165, 12954,  9119,  7106,  5822,  5016,  4463,  4038,  3703},
+    {21765, 13530,  9639,  7558,  6213,  5447,  4769,  4329,  3968},
+    {22455, 14075, 10113,  7956,  6567,  5628,  5030,  4513,  4126},
+    {22354, 13602,  9627,  7406,  6014,  5087,  4461,  3904,  3531},
+    {22597, 13417,  9346,  7121,  5647,  4694,  4083,  3554,  3147},
+    {24167, 14281,  9943,  7543,  5977,  5006,  4247,  3720,  3240},
+    {25608, 15130, 10546,  7939,  6406,  5274,  4480,  3911,  3476},
+    {27322, 16173, 11339,  8671,  7016,  5793,  4935,  4303,  3837},
+    {29034, 17358, 12184,  9299,  7511,  6201,  5310,  4616,  4062},
+    {31010, 18782, 13210, 10108,  8201,  6843,  5836,  5011,  4479},
+    {33097, 20408, 14425, 11107,  9094,  7557,  6532,  5730,  5047},
+    {35978, 23117, 16606, 13036, 10648,  8997,  7732,  6799,  5990},
+    {23573, 15612, 11921,  9823,  8535,  7615,  7010,  6453,  6017},
+    {35214, 22023, 15667, 12475, 10668,  9593,  8866,  8319,  7888},
+    {23026, 14756, 10792,  8426,  7085,  6072,  5446,  4917,  4464},
+    {23770, 15360, 11182,  8902,  7470,  6544,  5788,  5251,  4827},
+    {23663, 14906, 10758,  8411,  6923,  5881,  5168,  4669,  4213},
+    {24026, 14725, 10410,  8072,  6472,  5459,  4729,  4194,  3690},
+    {24595, 14636, 10325,  7760,  6199,  5083,  4358,  3814,  3363},
+    {26195, 15690, 11068,  8323,  6595,  5469,  4554,  4023,  3546},
+    {27909, 16717, 11855,  9001,  7224,  6031,  5121,  4465,  3849},
+    {29622, 17917, 12707,  9655,  7743,  6473,  5488,  4728,  4195},
+    {31596, 19426, 13611, 10532,  8497,  7053,  5949,  5176,  4591},
+    {33642, 21013, 14941, 11546,  9327,  7846,  6629,  5830,  5161},
+    {36549, 23729, 17248, 13503, 11082,  9435,  8106,  7078,  6289},
+    {24145, 16168, 12376, 10253,  8920,  8008,  7321,  6768,  6244},
+    {25311, 17310, 13433, 11146,  9658,  8612,  7899,  7270,  6826},
+    {37435, 24105, 17166, 13532, 11317,  9986,  9087,  8372,  7985},
+    {24981, 16632, 12380,  9899,  8223,  7188,  6430,  5866,  5340},
+    {24928, 16188, 11942,  9446,  7851,  6744,  5944,  5444,  4928},
+    {25271, 16024, 11698,  9066,  7411,  6330,  5526,  4937,  4460},
+    {25826, 16017, 11480,  8855,  7098,  5971,  5076,  4483,  4011},
+    {26689, 16102, 11318,  8628,  6870,  5684,  4850,  4224,  3645},
+    {28496, 17332, 12247,  9351,  7566,  6249,  5268,  4610,  3972},
+    {30298, 18498, 13057, 10111,  8063,  6673,  5684,  4854,  4288},
+    {32173, 19923, 14138, 10898,  8730,  7271,  6168,  5361,  4704},
+    {34304, 21637, 15459, 11951,  9685,  8057,  6917,  5967,  5302},
+    {37128, 24340, 17786, 13916, 11432,  9624,  8423,  7319,  6492},
+    {24756, 16667, 12786, 10594,  9156,  8238,  7472,  6922,  6502},
+    {25996, 17808, 13893, 11593, 10108,  8992,  8289,  7617,  7096},
+    {27169, 19047, 14873, 12462, 10830,  9680,  8850,  8162,  7622},
+    {39532, 26277, 19016, 14667, 12172, 10575,  9490,  8699,  8126},
+    {26198, 17541, 13088, 10397,  8696,  7467,  6705,  6028,  5510},
+    {26507, 17420, 12844, 10170,  8424,  7203,  6345,  5715,  5204},
+    {27163, 17382, 12646,  9863,  8102,  6845,  5983,  5288,  4689},
+    {27962, 17392, 12505,  9701,  7791,  6489,  5601,  4835,  4295},
+    {29054, 17747, 12645,  9675,  7828,  6449,  5482,  4752,  4215},
+    {30971, 19100, 13565, 10416,  8392,  6884,  5912,  5086,  4414},
+    {32879, 20512, 14647, 11246,  9034,  7538,  6428,  5542,  4822},
+    {34920, 22216, 16018, 12323, 10035,  8347,  7154,  6130,  5401},
+    {37819, 24997, 18379, 14446, 11789,  9995,  8614,  7511,  6636},
+    {24663, 16201, 12377, 10054,  8694,  7697,  6916,  6452,  5941},
+    {25873, 17499, 13395, 11047,  9567,  8494,  7726,  7075,  6540},
+    {27096, 18691, 14530, 12062, 10422,  9309,  8412,  7736,  7273},
+    {28245, 19887, 15594, 12904, 11159,  9970,  9068,  8383,  7799},
+    {41459, 28288, 20629, 16079, 13135, 11247, 10057,  9236,  8523},
+    {27718, 18618, 13998, 11175,  9265,  7929,  7006,  6286,  5717},
+    {28322, 18681, 13964, 11047,  9037,  7686,  6754,  6008,  5384},
+    {29130, 18743, 13859, 10846,  8784,  7441,  6423,  5688,  5046},
+    {30166, 19079, 13834, 10770,  8764,  7252,  6240,  5416,  4810},
+    {31378, 19482, 13953, 10773,  8667,  7205,  6107,  5247,  4604},
+    {33461, 21142, 15173, 11723,  9420,  7861,  6612,  5755,  5029},
+    {35572, 22890, 16582, 12796, 10407,  8635,  7378,  6413,  5623},
+    {37821, 24824, 18065, 14046, 11408,  9622,  8194,  7114,  6228},
+    {25008, 16070, 12102,  9868,  8358,  7384,  6610,  6044,  5571},
+    {26223, 17305, 13089, 10720,  9140,  8078,  7306,  6718,  6158},
+    {27450, 18519, 14248, 11715,  9992,  8952,  8012,  7352,  6801},
+    {28610, 19759, 15343, 12713, 10946,  9707,  8827,  8134,  7452},
+    {29728, 20877, 16367, 13616, 11723, 10427,  9537,  8634,  8112},
+    {43370, 30483, 22495, 17490, 14319, 12177, 10737,  9677,  8911},
+    {29504, 19950, 15096, 12111,  9969,  8546,  7448,  6752,  6062},
+    {30290, 20124, 15055, 12021,  9888,  8425,  7244,  6443,  5758},
+    {31373, 20439, 15205, 12084,  9836,  8319,  7110,  6297,  5677},
+    {32596, 20893, 15336, 12029,  9745,  8152,  6883,  6036,  5350},
+    {33901, 21698, 15677, 12177,  9878,  8150,  6961,  6009,  5261},
+    {36183, 23574, 17205, 13415, 10894,  9092,  7724,  6659,  5857},
+    {38557, 25748, 18833, 14684, 11977, 10071,  8569,  7433,  6504},
+    {26354, 16888, 12709, 10314,  8733,  7667,  6860,  6272,  5734},
+    {26793, 17342, 13000, 10535,  9014,  7809,  6996,  6382,  5834},
+    {27966, 18487, 14043, 11440,  9783,  8573,  7703,  7008,  6430},
+    {29219, 19669, 15179, 12467, 10704,  9362,  8480,  7695,  7096},
+    {30283, 20925, 16334, 13449, 11594, 10195,  9264,  8334,  7779},
+    {31333, 22133, 17416, 14518, 12397, 10972,  9815,  9054,  8350},
+    {45304, 32721, 24707, 19288, 15708, 13304, 11651, 10355,  9512},
+    {31563, 21363, 16384, 13114, 10901,  9360,  8094,  7193,  6402},
+    {32667, 21896, 16649, 13333, 11049,  9392,  8179,  7235,  6512},
+    {33752, 22364, 16769, 13313, 10920,  9290,  7956,  6987,  6160},
+    {35086, 23071, 17135, 13492, 11004,  9302,  7976,  6909,  6043},
+    {36642, 24166, 17801, 13997, 11361,  9525,  8172,  7058,  6100},
+    {39260, 26481, 19637, 15368, 12625, 10558,  9007,  7793,  6884},
+    {27793, 17766, 13230, 10780,  9162,  8009,  7203,  6520,  5989},
+    {28353, 18272, 13668, 11051,  9311,  8192,  7270,  6610,  6047},
+    {28722, 18587, 14002, 11344,  9551,  8367,  7459,  6727,  6210},
+    {29923, 19768, 15071, 12256, 10407,  9121,  8214,  7397,  6807},
+    {31028, 21070, 16235, 13319, 11318,  9904,  8965,  8178,  7424},
+    {32176, 22277, 17498, 14335, 12389, 10762,  9802,  8896,  8212},
+    {33284, 23541, 18699, 15512, 13278, 11674, 10438,  9494,  8744},
+    {47195, 35147, 26964, 21297, 17412, 14682, 12689, 11289, 10235},
+    {33740, 23340, 18115, 14745, 12407, 10576,  9243,  8203,  7421},
+    {34879, 23846, 18266, 14704, 12262, 10487,  9083,  7937,  7148},
+    {36311, 24548, 18652, 14923, 12424, 10487,  9064,  7942,  7003},
+    {37864, 25713, 19329, 15397, 12737, 10750,  9294,  8134,  7114},
+    {39847, 27201, 20370, 16114, 13173, 11178,  9568,  8312,  7362},
+    {29422, 18791, 14036, 11482,  9727,  8506,  7638,  6965,  6444},
+    {29947, 19258, 14500, 11776, 10003,  8726,  7780,  7011,  6468},
+    {30530, 19804, 14892, 12117, 10249,  8938,  7941,  7256,  6603},
+    {30954, 20197, 15218, 12387, 10477,  9143,  8161,  7312,  6679},
+    {32059, 21434, 16375, 13375, 11308,  9906,  8883,  7959,  7327},
+    {33139, 22700, 17631, 14502, 12411, 10858,  9707,  8797,  8090},
+    {34366, 24055, 18984, 15741, 13461, 11816, 10642,  9705,  8863},
+    {35414, 25397, 20320, 17029, 14698, 12911, 11638, 10514,  9710},
+    {49191, 37802, 29603, 23820, 19562, 16530, 14306, 12503, 11281},
+    {36184, 25497, 20142, 16589, 14070, 12183, 10697,  9510,  8559},
+    {37518, 26319, 20544, 16815, 14210, 12308, 10656,  9507,  8453},
+    {39201, 27492, 21199, 17305, 14614, 12537, 10893,  9674,  8566},
+    {41093, 29056, 22275, 17995, 15100, 12907, 11265,  9830,  8776},
+    {30973, 19893, 14859, 12080, 10301,  9017,  8074,  7295,  6764},
+    {31582, 20392, 15237, 12386, 10521,  9263,  8219,  7457,  6869},
+    {32189, 20876, 15747, 12732, 10775,  9403,  8354,  7553,  6911},
+    {32769, 21421, 16183, 13132, 11082,  9638,  8577,  7698,  7031},
+    {33136, 21860, 16522, 13410, 11342,  9858,  8768,  7831,  7208},
+    {34345, 23238, 17746, 14519, 12326, 10747,  9595,  8607,  7879},
+    {35393, 24563, 19058, 15728, 13439, 11713, 10465,  9466,  8680},
+    {36489, 25826, 20421, 17028, 14620, 12863, 11528, 10416,  9543},
+    {37694, 27520, 22185, 18816, 16274, 14442, 12959, 11808, 10872},
+    {50753, 40063, 32259, 26415, 21963, 18642, 16115, 14226, 12657},
+    {38096, 27037, 21332, 17631, 14981, 12992, 11353, 10064,  8962},
+    {39706, 28158, 22022, 18153, 15423, 13308, 11617, 10211,  9220},
+    {41669, 29875, 23147, 18944, 15944, 13689, 11953, 10587,  9361},
+    {32902, 21245, 15829, 12990, 10981,  9660,  8614,  7802,  7210},
+    {33429, 21744, 16337, 13249, 11270,  9900,  8794,  7978,  7259},
+    {33952, 22316, 16737, 13594, 11510, 10054,  8965,  8057,  7391},
+    {34635, 22848, 17152, 13906, 11812, 10267,  9158,  8269,  7538},
+    {35116, 23371, 17711, 14339, 12097, 10497,  9351,  8406,  7735},
+    {35610, 23949, 18141, 14730, 12507, 10806,  9631,  8703,  7880},
+    {36692, 25260, 19511, 16002, 13559, 11824, 10551,  9480,  8590},
+    {37733, 26636, 20865, 17242, 14838, 12975, 11534, 10462,  9528},
+    {38966, 28266, 22633, 19013, 16490, 14564, 13084, 11881, 10843},
+    {39529, 28937, 23388, 19800, 17165, 15183, 13629, 12371, 11317},
+    {52350, 42571, 35080, 29305, 24813, 21313, 18507, 16308, 14586},
+    {40271, 29023, 23100, 19223, 16383, 14310, 12515, 11098,  9867},
+    {42195, 30710, 24192, 19930, 16946, 14740, 12913, 11494, 10207},
+    {34870, 22843, 17183, 13975, 11969, 10493,  9398,  8515,  7815},
+    {35453, 23424, 17641, 14283, 12236, 10643,  9573,  8658,  7914},
+    {35994, 23932, 18060, 14660, 12454, 10903,  9765,  8812,  8007},
+    {36544, 24522, 18549, 15062, 12801, 11158,  9949,  8983,  8229},
+    {37097, 25086, 18987, 15489, 13138, 11387, 10165,  9196,  8352},
+    {37730, 25713, 19659, 15961, 13527, 11718, 10506,  9437,  8587},
+    {38231, 26352, 20219, 16484, 14030, 12203, 10834,  9769,  8834},
+    {39352, 27671, 21577, 17780, 15244, 13362, 11890, 10697,  9708},
+    {40549, 29383, 23364, 19512, 16906, 14874, 13435, 12109, 11065},
+    {40981, 30052, 24107, 20365, 17640, 15606, 13965, 12591, 11506},
+    {41498, 30826, 25046, 21314, 18551, 16482, 14715, 13388, 12236},
+    {53978, 45162, 38172, 32605, 28107, 24486, 21541, 19141, 17092},
+    {42793, 31646, 25272, 21192, 18293, 16005, 14140, 12617, 11257},
+    {37627, 25448, 19326, 15808, 13486, 11987, 10685,  9715,  8901},
+    {38139, 25976, 19822, 16276, 13839, 12181, 10962,  9879,  9148},
+    {38687, 26587, 20303, 16570, 14160, 12532, 11175, 10174,  9300},
+    {39269, 27150, 20797, 16970, 14561, 12782, 11339, 10376,  9483},
+    {39233, 26930, 20501, 16650, 14119, 12345, 11032, 10004,  9173},
+    {39969, 27784, 21271, 17300, 14673, 12800, 11422, 10288,  9364},
+    {40620, 28520, 21952, 17955, 15237, 13266, 11757, 10637,  9687},
+    {41164, 29194, 22611, 18543, 15850, 13807, 12300, 11017, 10061},
+    {42310, 30875, 24434, 20336, 17504, 15439, 13751, 12504, 11357},
+    {42856, 31545, 25226, 21112, 18268, 16124, 14424, 13085, 11897},
+    {43401, 32320, 26172, 22064, 19245, 17048, 15220, 13871, 12664},
+    {43923, 33234, 27144, 23255, 20370, 18193, 16375, 14783, 13537},
+    {55832, 48203, 41831, 36627, 32211, 28473, 25376, 22728, 20409},
+};
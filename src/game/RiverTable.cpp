@@ -0,0 +1,230 @@
+#include "../../include/game/RiverTable.h"
+#include "../../include/core/Combinatorics.h"
+#include "../../include/game/HandTables.h"
+
+using Combinatorics::Combinations;
+
+// The holdings the hero beats (outcome 0) or ties (outcome 1), per card:
+// bit j of neighbours[o][i] is set when the holding {i, j} has outcome o,
+// degree[o][i] counts those holdings, and neighbourDegree[o][p][i] adds up
+// degree[p] over them. Pairs of disjoint holdings are counted from these
+// sums, with or without the two cards of a third holding.
+struct HoldingOutcomes {
+    uint64_t neighbours[2][Card::NUM_CARDS] = {};
+    double degree[2][Card::NUM_CARDS] = {};
+    double neighbourDegree[2][2][Card::NUM_CARDS] = {};
+    double holdings[2] = {};
+    // Sum over cards of degree[o] * degree[p].
+    double degreeProducts[2][2] = {};
+};
+
+// Unordered pairs of disjoint holdings by how many of the two tie the hero.
+// Two distinct holdings share at most one card, so the pairs sharing one
+// are counted once at that card, from the degree products, and taken out.
+static void countPairs(const double holdings[2], const double degreeProducts[2][2], double pairs[3]) {
+    pairs[0] = holdings[0] * (holdings[0] - 1) / 2 - (degreeProducts[0][0] - 2 * holdings[0]) / 2;
+    pairs[1] = holdings[0] * holdings[1] - degreeProducts[0][1];
+    pairs[2] = holdings[1] * (holdings[1] - 1) / 2 - (degreeProducts[1][1] - 2 * holdings[1]) / 2;
+}
+
+// The pairs clear of the cards a and b of a holding with the given outcome.
+// Removing the two cards lowers the degree of each of their neighbours, so
+// the sums are corrected term by term instead of recounted.
+static void countPairsWithout(const HoldingOutcomes& o, int a, int b, int outcome, double pairs[3]) {
+    double holdings[2];
+    for (int p = 0; p < 2; ++p) {
+        holdings[p] = o.holdings[p] - o.degree[p][a] - o.degree[p][b] + (outcome == p);
+    }
+    // Cards holding the given outcomes with a and with b. A holding has
+    // one outcome, so the two mixed sets are disjoint and counted together.
+    double shared[2][2];
+    shared[0][0] = 2 * __builtin_popcountll(o.neighbours[0][a] & o.neighbours[0][b]);
+    shared[1][1] = 2 * __builtin_popcountll(o.neighbours[1][a] & o.neighbours[1][b]);
+    shared[0][1] = __builtin_popcountll((o.neighbours[0][a] & o.neighbours[1][b]) |
+                                        (o.neighbours[1][a] & o.neighbours[0][b]));
+    shared[1][0] = shared[0][1];
+    double products[2][2];
+    for (int p = 0; p < 2; ++p) {
+        for (int q = 0; q < 2; ++q) {
+            // Sum over the other cards v of (degree[p][v] - lost[p][v]) *
+            // (degree[q][v] - lost[q][v]), where lost counts v's holdings
+            // with a or b. A card cannot lose holdings of both outcomes
+            // through the same one of a and b.
+            double lostTimesDegree = o.neighbourDegree[p][q][a] + o.neighbourDegree[p][q][b] -
+                                     (outcome == p) * (o.degree[q][a] + o.degree[q][b]);
+            double degreeTimesLost = o.neighbourDegree[q][p][a] + o.neighbourDegree[q][p][b] -
+                                     (outcome == q) * (o.degree[p][a] + o.degree[p][b]);
+            double lostTimesLost = shared[p][q];
+            if (p == q) {
+                lostTimesLost += o.degree[p][a] + o.degree[p][b] - 2 * (outcome == p);
+            }
+            products[p][q] = o.degreeProducts[p][q] - o.degree[p][a] * o.degree[q][a] -
+                             o.degree[p][b] * o.degree[q][b] - lostTimesDegree - degreeTimesLost + lostTimesLost;
+        }
+    }
+    countPairs(holdings, products, pairs);
+}
+
+int RiverTable::holdingIndex(CardSet hand) {
+    uint64_t mask = hand.mask();
+    Card low = CardSet::cardAt(__builtin_ctzll(mask));
+    Card high = CardSet::cardAt(63 - __builtin_clzll(mask));
+    return static_cast<int>(Combinatorics::colexRank((1ull << low.getIndex()) | (1ull << high.getIndex())));
+}
+
+RiverTable::RiverTable(CardSet board)
+    : board_(board), ranks_(NUM_HOLDINGS, 0), wins_(NUM_HOLDINGS, 0.0f), ties_(NUM_HOLDINGS, 0.0f) {
+    Card live[Card::NUM_CARDS];
+    int count = 0;
+    for (Card card : CardSet::fullDeck() - board) {
+        live[count++] = card;
+    }
+
+    struct Holding {
+        int index;
+        uint8_t first;
+        uint8_t second;
+    };
+    std::vector<Holding> holdings;
+    std::vector<uint64_t> masks;
+    holdings.reserve(count * (count - 1) / 2);
+    masks.reserve(count * (count - 1) / 2);
+    for (uint64_t pair : Combinations(count, 2)) {
+        Card first = live[__builtin_ctzll(pair)];
+        Card second = live[63 - __builtin_clzll(pair)];
+        CardSet hand(first.getBit() | second.getBit());
+        holdings.push_back(Holding{holdingIndex(hand), static_cast<uint8_t>(first.getIndex()),
+                                   static_cast<uint8_t>(second.getIndex())});
+        masks.push_back((board | hand).mask());
+    }
+    std::vector<int32_t> values(masks.size());
+    HandTables::instance().evaluateBatch(masks.data(), values.data(), static_cast<int>(masks.size()));
+    // Ranks are dense below 7463, so a counting sort puts the holdings in
+    // rank order in two linear passes.
+    std::vector<uint16_t> starts(HandTables::NUM_HAND_RANKS + 2, 0);
+    for (size_t i = 0; i < holdings.size(); ++i) {
+        this->ranks_[holdings[i].index] = static_cast<uint16_t>(values[i]);
+        starts[values[i] + 1]++;
+    }
+    for (size_t rank = 1; rank < starts.size(); ++rank) {
+        starts[rank] += starts[rank - 1];
+    }
+    std::vector<Holding> sorted(holdings.size());
+    for (size_t i = 0; i < holdings.size(); ++i) {
+        sorted[starts[values[i]]++] = holdings[i];
+    }
+    holdings.swap(sorted);
+
+    // Sweep the holdings weakest first, one group of equal rank at a time.
+    // Holdings below the group, less those sharing a card with the hero,
+    // are the wins; the rest of the group, less the same, are the ties.
+    // A holding sharing both cards is the hero's own, so no pair is
+    // subtracted twice.
+    int weaker = 0;
+    int weakerWithCard[Card::NUM_CARDS] = {0};
+    int groupWithCard[Card::NUM_CARDS] = {0};
+    int opponents = (count - 2) * (count - 3) / 2;
+    for (size_t start = 0, end; start < holdings.size(); start = end) {
+        int rank = this->ranks_[holdings[start].index];
+        for (end = start; end < holdings.size() && this->ranks_[holdings[end].index] == rank; ++end) {
+            groupWithCard[holdings[end].first]++;
+            groupWithCard[holdings[end].second]++;
+        }
+        int group = static_cast<int>(end - start);
+        for (size_t i = start; i < end; ++i) {
+            const Holding& h = holdings[i];
+            int wins = weaker - weakerWithCard[h.first] - weakerWithCard[h.second];
+            int ties = (group - 1) - (groupWithCard[h.first] - 1) - (groupWithCard[h.second] - 1);
+            this->wins_[h.index] = static_cast<float>(wins) / opponents;
+            this->ties_[h.index] = static_cast<float>(ties) / opponents;
+        }
+        for (size_t i = start; i < end; ++i) {
+            weakerWithCard[holdings[i].first]++;
+            weakerWithCard[holdings[i].second]++;
+            groupWithCard[holdings[i].first] = 0;
+            groupWithCard[holdings[i].second] = 0;
+        }
+        weaker += group;
+    }
+}
+
+float RiverTable::equity(CardSet hand, int numOpponents) const {
+    if (hand.size() != 2 || hand.intersects(this->board_) || numOpponents > MAX_OPPONENTS) {
+        return 0.0f;
+    }
+    if (numOpponents <= 0) {
+        return 1.0f;
+    }
+    if (numOpponents == 1) {
+        return this->winShare(hand) + this->tieShare(hand) * 0.5f;
+    }
+
+    // Opponents' holdings block each other, so deals of disjoint holdings
+    // are counted outright; a deal in which t opponents tie the hero and
+    // the rest lose pays 1/(t+1).
+    uint64_t unseen = 0;
+    for (Card card : CardSet::fullDeck() - this->board_ - hand) {
+        unseen |= 1ull << card.getIndex();
+    }
+    int heroRank = this->handRank(hand);
+    HoldingOutcomes outcomes;
+    for (uint64_t rest = unseen; rest; rest &= rest - 1) {
+        int first = __builtin_ctzll(rest);
+        for (uint64_t others = rest & (rest - 1); others; others &= others - 1) {
+            int second = __builtin_ctzll(others);
+            // The colex rank of {first, second}.
+            int rank = this->ranks_[first + second * (second - 1) / 2];
+            if (rank <= heroRank) {
+                int outcome = rank == heroRank;
+                outcomes.neighbours[outcome][first] |= 1ull << second;
+                outcomes.neighbours[outcome][second] |= 1ull << first;
+                outcomes.degree[outcome][first]++;
+                outcomes.degree[outcome][second]++;
+                outcomes.holdings[outcome]++;
+            }
+        }
+    }
+    for (uint64_t rest = unseen; rest; rest &= rest - 1) {
+        int card = __builtin_ctzll(rest);
+        for (int p = 0; p < 2; ++p) {
+            for (int q = 0; q < 2; ++q) {
+                outcomes.degreeProducts[p][q] += outcomes.degree[p][card] * outcomes.degree[q][card];
+                for (uint64_t others = outcomes.neighbours[p][card]; others; others &= others - 1) {
+                    outcomes.neighbourDegree[p][q][card] += outcomes.degree[q][__builtin_ctzll(others)];
+                }
+            }
+        }
+    }
+
+    double deals[MAX_OPPONENTS + 1] = {};
+    if (numOpponents == 2) {
+        countPairs(outcomes.holdings, outcomes.degreeProducts, deals);
+    } else {
+        // A deal of three is a holding plus a pair clear of its cards, and
+        // is found once from each of its holdings.
+        for (int outcome = 0; outcome < 2; ++outcome) {
+            for (uint64_t rest = unseen; rest; rest &= rest - 1) {
+                int first = __builtin_ctzll(rest);
+                uint64_t later = outcomes.neighbours[outcome][first] & ~((2ull << first) - 1);
+                for (; later; later &= later - 1) {
+                    double pairs[3];
+                    countPairsWithout(outcomes, first, __builtin_ctzll(later), outcome, pairs);
+                    for (int ties = 0; ties < 3; ++ties) {
+                        deals[ties + outcome] += pairs[ties] / 3;
+                    }
+                }
+            }
+        }
+    }
+
+    double total = 1.0;
+    int cards = __builtin_popcountll(unseen);
+    for (int opponent = 0; opponent < numOpponents; ++opponent) {
+        total *= static_cast<double>(Combinatorics::binomial(cards - 2 * opponent, 2)) / (opponent + 1);
+    }
+    double paid = 0.0;
+    for (int ties = 0; ties <= numOpponents; ++ties) {
+        paid += deals[ties] / (ties + 1);
+    }
+    return static_cast<float>(paid / total);
+}
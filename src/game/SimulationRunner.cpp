@@ -0,0 +1,116 @@
+#include "../../include/game/SimulationRunner.h"
+#include "../../include/core/FastRandom.h"
+#include "../../include/core/SeatTable.h"
+#include "../../include/core/ThreadPool.h"
+#include "../../include/game/HandEvaluator.h"
+#include "../../include/game/PokerGame.h"
+#include "../../include/ui/NullView.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+static const double Z_95 = 1.96;
+
+SimulationRunner::SimulationRunner(const GameSettings& settings) : settings(settings) {
+    this->settings.humanPlayer = false;
+    this->settings.calculateWinChance = false;
+    this->settings.showOuts = false;
+    if (this->settings.botDifficulties.empty()) {
+        this->settings.botDifficulties.assign(this->settings.numBots, this->settings.difficulty);
+    }
+    if (this->settings.botDifficulties.size() > SeatTable::MAX_SEATS) {
+        this->settings.botDifficulties.resize(SeatTable::MAX_SEATS);
+    }
+    this->settings.numBots = static_cast<int>(this->settings.botDifficulties.size());
+    if (this->settings.seed == 0) {
+        this->settings.seed = std::chrono::steady_clock::now().time_since_epoch().count();
+    }
+}
+
+BatchResult SimulationRunner::runHands(int64_t hands, int tableHands) {
+    tableHands = std::max(1, tableHands);
+    int tables = static_cast<int>((hands + tableHands - 1) / tableHands);
+    return this->run(tables, tableHands, hands - static_cast<int64_t>(tables - 1) * tableHands, false);
+}
+
+BatchResult SimulationRunner::runTournaments(int tournaments) {
+    return this->run(tournaments, 0, 0, true);
+}
+
+BatchResult SimulationRunner::run(int tables, int tableHands, int64_t lastTableHands, bool tournaments) {
+    int numBots = this->settings.numBots;
+    BatchResult batch;
+    batch.seed = this->settings.seed;
+    batch.bots.resize(numBots);
+    if (tables <= 0 || numBots < 2) {
+        return batch;
+    }
+
+    // One slot per table, indexed by lineup position rather than seat.
+    std::vector<SimulationResult> slots(tables);
+    auto start = std::chrono::steady_clock::now();
+    ThreadPool::instance().parallelFor(tables, [&](int table) {
+        int rotation = table % numBots;
+        GameSettings tableSettings = this->settings;
+        tableSettings.seed = FastRandom::streamSeed(this->settings.seed, table);
+        for (int seat = 0; seat < numBots; ++seat) {
+            tableSettings.botDifficulties[seat] = this->settings.botDifficulties[(seat + rotation) % numBots];
+        }
+
+        PokerGame game(std::make_shared<NullView>(), tableSettings, std::make_shared<HandEvaluator>(false));
+        SimulationResult seats = tournaments
+            ? game.simulateTournaments(1)
+            : game.simulate(static_cast<int>(table == tables - 1 ? lastTableHands : tableHands));
+
+        SimulationResult& slot = slots[table];
+        slot.hands = seats.hands;
+        slot.tournaments = seats.tournaments;
+        slot.netChips.assign(numBots, 0);
+        slot.tournamentWins.assign(numBots, 0);
+        for (int seat = 0; seat < numBots; ++seat) {
+            slot.netChips[(seat + rotation) % numBots] = seats.netChips[seat];
+            slot.tournamentWins[(seat + rotation) % numBots] = seats.tournamentWins[seat];
+        }
+    });
+    batch.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    batch.tables = tables;
+    for (const SimulationResult& slot : slots) {
+        batch.hands += slot.hands;
+        batch.tournaments += slot.tournaments;
+    }
+
+    double bigBlind = 2.0 * this->settings.smallBlind;
+    for (int bot = 0; bot < numBots; ++bot) {
+        BotSummary& summary = batch.bots[bot];
+        summary.difficulty = this->settings.botDifficulties[bot];
+
+        for (const SimulationResult& slot : slots) {
+            summary.netChips += slot.netChips[bot];
+            summary.tournamentWins += slot.tournamentWins[bot];
+        }
+        if (batch.hands > 0) {
+            summary.bbPer100 = summary.netChips / bigBlind * 100.0 / batch.hands;
+        }
+        // Each table's bb/100 is one batch mean and the batch rate is their
+        // mean weighted by hands, so a short last table counts for less in
+        // the spread too: Var = T/(T-1) * sum (n_i/N)^2 (rate_i - rate)^2.
+        if (tables > 1 && batch.hands > 0) {
+            double spread = 0.0;
+            for (const SimulationResult& slot : slots) {
+                if (slot.hands == 0) continue;
+                double weight = static_cast<double>(slot.hands) / batch.hands;
+                double rate = slot.netChips[bot] / bigBlind * 100.0 / slot.hands;
+                spread += weight * weight * (rate - summary.bbPer100) * (rate - summary.bbPer100);
+            }
+            summary.bbPer100Error = Z_95 * std::sqrt(spread * tables / (tables - 1));
+        }
+        if (batch.tournaments > 0) {
+            double p = static_cast<double>(summary.tournamentWins) / batch.tournaments;
+            summary.winRate = p;
+            summary.winRateError = Z_95 * std::sqrt(p * (1.0 - p) / batch.tournaments);
+        }
+    }
+    return batch;
+}
@@ -1,94 +1,80 @@
 #include "../../include/players/BotPlayer.h"
 #include "../../include/core/Card.h"
 #include "../../include/game/HandEvaluator.h"
+#include "../../include/game/HandTables.h"
+#include "../../include/game/PreflopTable.h"
 #include <algorithm>
-#include <random>
 #include <chrono>
 
-BotPlayer::BotPlayer(std::string name, int balance, int difficulty)
-    : name(name), balance(balance), active(true), currentBet(0), 
-      difficulty(difficulty), rng(std::chrono::steady_clock::now().time_since_epoch().count()) {
+BotPlayer::BotPlayer(std::string name, int difficulty)
+    : BotPlayer(name, difficulty, std::chrono::steady_clock::now().time_since_epoch().count()) {
 }
 
-std::string BotPlayer::getName() {
-    return this->name;
-}
-
-int BotPlayer::getBalance() {
-    return this->balance;
-}
-
-void BotPlayer::addChips(int amount) {
-    this->balance += amount;
+BotPlayer::BotPlayer(std::string name, int difficulty, uint64_t seed)
+    : name(name), difficulty(difficulty), rng(seed) {
 }
 
-bool BotPlayer::removeChips(int amount) {
-    if (amount > this->balance) {
-        return false;
-    }
-    this->balance -= amount;
-    return true;
-}
-
-void BotPlayer::receiveCard(Card card) {
-    this->hand.push_back(card);
-}
-
-std::vector<Card>& BotPlayer::getHand() {
-    return this->hand;
-}
-
-void BotPlayer::clearHand() {
-    this->hand.clear();
+std::string BotPlayer::getName() {
+    return this->name;
 }
 
 float BotPlayer::evaluateHandStrength(GameState& state) {
-    if (this->hand.size() != 2) {
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-        return dist(this->rng);
+    int seat = state.currentPlayerIndex;
+    CardSet hand = state.seats.hand[seat];
+    if (hand.size() != 2) {
+        return this->rng.nextFloat();
+    }
+    
+    int numOpponents = 0;
+    for (int i = 0; i < state.seats.count; ++i) {
+        if (i != seat && state.seats.inHand(i)) {
+            numOpponents++;
+        }
+    }
+    
+    if (state.communitySet.empty() || (state.communitySet.size() == 5 && state.evaluator)) {
+        // Preflop from the equity table; on the river from the evaluator's
+        // per-board holding ranking, which every seat shares.
+        float equity;
+        if (state.communitySet.empty()) {
+            Card low = CardSet::cardAt(__builtin_ctzll(hand.mask()));
+            Card high = CardSet::cardAt(63 - __builtin_clzll(hand.mask()));
+            equity = PreflopTable::equity(low, high, std::max(1, numOpponents));
+        } else {
+            equity = state.evaluator->calculateWinProbability(hand.toCards(), state.communityCards, std::max(1, numOpponents));
+        }
+        
+        float randomness = (10.0f - this->difficulty) / 10.0f * 0.1f;
+        equity += this->rng.nextFloat(-randomness, randomness);
+        
+        return std::max(0.0f, std::min(1.0f, equity));
     }
     
     if (state.evaluator) {
-        int handValue = state.evaluator->evaluateBestHand(this->hand, state.communityCards);
+        int handValue = state.evaluator->evaluateBestHand(hand, state.communitySet);
         
+        // Each category owns a 0.10 band from 0.05 (high card) up to 0.95
+        // (royal flush); the hand's rank places it within its band.
         float normalized = 0.0f;
-        
-        if (handValue >= HAND_ROYAL_FLUSH) {
-            normalized = 0.95f + (handValue - HAND_ROYAL_FLUSH) / 1000000.0f * 0.05f;
-        } else if (handValue >= HAND_STRAIGHT_FLUSH) {
-            normalized = 0.85f + (handValue - HAND_STRAIGHT_FLUSH) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_FOUR_OF_A_KIND) {
-            normalized = 0.75f + (handValue - HAND_FOUR_OF_A_KIND) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_FULL_HOUSE) {
-            normalized = 0.65f + (handValue - HAND_FULL_HOUSE) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_FLUSH) {
-            normalized = 0.55f + (handValue - HAND_FLUSH) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_STRAIGHT) {
-            normalized = 0.45f + (handValue - HAND_STRAIGHT) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_THREE_OF_A_KIND) {
-            normalized = 0.35f + (handValue - HAND_THREE_OF_A_KIND) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_TWO_PAIR) {
-            normalized = 0.25f + (handValue - HAND_TWO_PAIR) / 1000000.0f * 0.10f;
-        } else if (handValue >= HAND_ONE_PAIR) {
-            normalized = 0.15f + (handValue - HAND_ONE_PAIR) / 1000000.0f * 0.10f;
-        } else {
-            normalized = 0.05f + (handValue - HAND_HIGH_CARD) / 1000000.0f * 0.10f;
+        if (handValue > 0) {
+            int category = HandTables::instance().category(handValue);
+            int first = HandTables::firstRank(category);
+            float withinCategory = static_cast<float>(handValue - first) / (HandTables::endRank(category) - first);
+            normalized = 0.05f + category * 0.10f + withinCategory * 0.10f;
         }
         
         float randomness = (10.0f - this->difficulty) / 10.0f * 0.1f;
-        std::uniform_real_distribution<float> dist(-randomness, randomness);
-        normalized += dist(this->rng);
+        normalized += this->rng.nextFloat(-randomness, randomness);
         
         return std::max(0.0f, std::min(1.0f, normalized));
     }
     
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    return dist(this->rng);
+    return this->rng.nextFloat();
 }
 
 float BotPlayer::calculatePotOdds(GameState& state) {
     if (state.pot == 0) return 0.0f;
-    int callAmount = state.currentBet - this->currentBet;
+    int callAmount = state.currentBet - state.seats.currentBet[state.currentPlayerIndex];
     if (callAmount <= 0) return 1.0f;
     return static_cast<float>(state.pot) / (state.pot + callAmount);
 }
@@ -101,8 +87,7 @@ float BotPlayer::getBluffProbability() {
 }
 
 Action BotPlayer::makeSimpleDecision(GameState& state, float handStrength) {
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    float random = dist(this->rng);
+    float random = this->rng.nextFloat();
     
     Action action;
     if (random < 0.4f || handStrength < 0.3f) {
@@ -116,8 +101,9 @@ Action BotPlayer::makeSimpleDecision(GameState& state, float handStrength) {
 }
 
 Action BotPlayer::makeMediumDecision(GameState& state, float handStrength, float potOdds) {
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    float random = dist(this->rng);
+    int balance = state.seats.balance[state.currentPlayerIndex];
+    int currentBet = state.seats.currentBet[state.currentPlayerIndex];
+    float random = this->rng.nextFloat();
     
     Action action;
     if (handStrength < 0.4f && potOdds < 0.3f) {
@@ -126,8 +112,8 @@ Action BotPlayer::makeMediumDecision(GameState& state, float handStrength, float
         if (random < 0.3f) {
             action.type = ACTION_RAISE;
             int minRaise = state.currentBet + state.smallBlind;
-            int raiseAmount = std::max(state.smallBlind, (int)(this->balance * 0.2f));
-            action.amount = std::min(this->balance + this->currentBet, minRaise + raiseAmount);
+            int raiseAmount = std::max(state.smallBlind, (int)(balance * 0.2f));
+            action.amount = std::min(balance + currentBet, minRaise + raiseAmount);
         } else {
             action.type = ACTION_CALL;
         }
@@ -138,8 +124,9 @@ Action BotPlayer::makeMediumDecision(GameState& state, float handStrength, float
 }
 
 Action BotPlayer::makeAdvancedDecision(GameState& state, float handStrength, float potOdds, float bluffProb) {
-    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-    float random = dist(this->rng);
+    int balance = state.seats.balance[state.currentPlayerIndex];
+    int currentBet = state.seats.currentBet[state.currentPlayerIndex];
+    float random = this->rng.nextFloat();
     
     Action action;
     
@@ -147,8 +134,8 @@ Action BotPlayer::makeAdvancedDecision(GameState& state, float handStrength, flo
         if (random < 0.6f) {
             action.type = ACTION_RAISE;
             int minRaise = state.currentBet + state.smallBlind;
-            int raiseAmount = std::max(state.smallBlind * 2, (int)(this->balance * 0.3f));
-            action.amount = std::min(this->balance + this->currentBet, minRaise + raiseAmount);
+            int raiseAmount = std::max(state.smallBlind * 2, (int)(balance * 0.3f));
+            action.amount = std::min(balance + currentBet, minRaise + raiseAmount);
         } else {
             action.type = ACTION_CALL;
         }
@@ -156,8 +143,8 @@ Action BotPlayer::makeAdvancedDecision(GameState& state, float handStrength, flo
     else if (random < bluffProb && handStrength > 0.4f) {
         action.type = ACTION_RAISE;
         int minRaise = state.currentBet + state.smallBlind;
-        int raiseAmount = std::max(state.smallBlind, (int)(this->balance * 0.15f));
-        action.amount = std::min(this->balance + this->currentBet, minRaise + raiseAmount);
+        int raiseAmount = std::max(state.smallBlind, (int)(balance * 0.15f));
+        action.amount = std::min(balance + currentBet, minRaise + raiseAmount);
     }
     else if (handStrength < 0.3f && potOdds < 0.25f) {
         action.type = ACTION_FOLD;
@@ -173,7 +160,9 @@ Action BotPlayer::makeAdvancedDecision(GameState& state, float handStrength, flo
 }
 
 Action BotPlayer::makeDecision(GameState& state) {
-    if (!this->active || this->balance == 0) {
+    int balance = state.seats.balance[state.currentPlayerIndex];
+    int currentBet = state.seats.currentBet[state.currentPlayerIndex];
+    if (!state.seats.active[state.currentPlayerIndex] || balance == 0) {
         Action action;
         action.type = ACTION_FOLD;
         return action;
@@ -193,45 +182,24 @@ Action BotPlayer::makeDecision(GameState& state) {
         action = this->makeAdvancedDecision(state, handStrength, potOdds, bluffProb);
     }
     
-    int callAmount = state.currentBet - this->currentBet;
+    int callAmount = state.currentBet - currentBet;
     
     if (action.type == ACTION_CALL) {
-        if (callAmount >= this->balance) {
+        if (callAmount >= balance) {
             action.type = ACTION_ALL_IN;
-            action.amount = this->balance + this->currentBet;
+            action.amount = balance + currentBet;
         }
     } else if (action.type == ACTION_RAISE) {
-        if (action.amount >= this->balance + this->currentBet) {
+        if (action.amount >= balance + currentBet) {
             action.type = ACTION_ALL_IN;
-            action.amount = this->balance + this->currentBet;
+            action.amount = balance + currentBet;
         } else {
             int minRaise = state.currentBet + state.smallBlind;
             if (action.amount < minRaise) {
-                action.amount = std::min(minRaise, this->balance + this->currentBet);
+                action.amount = std::min(minRaise, balance + currentBet);
             }
         }
     }
     
     return action;
 }
-
-bool BotPlayer::isActive() {
-    return this->active;
-}
-
-void BotPlayer::setActive(bool active) {
-    this->active = active;
-}
-
-int BotPlayer::getCurrentBet() {
-    return this->currentBet;
-}
-
-void BotPlayer::setCurrentBet(int bet) {
-    this->currentBet = bet;
-}
-
-void BotPlayer::resetCurrentBet() {
-    this->currentBet = 0;
-}
-
@@ -1,50 +1,25 @@
 #include "../../include/players/HumanPlayer.h"
 #include <iostream>
 
-HumanPlayer::HumanPlayer(std::string name, int balance, std::shared_ptr<IGameView> view)
-    : name(name), balance(balance), active(true), currentBet(0), view(view) {
+HumanPlayer::HumanPlayer(std::string name, std::shared_ptr<IGameView> view)
+    : name(name), view(view) {
 }
 
-HumanPlayer::HumanPlayer(std::string name, int balance)
-    : name(name), balance(balance), active(true), currentBet(0), view(nullptr) {
+HumanPlayer::HumanPlayer(std::string name)
+    : name(name), view(nullptr) {
 }
 
 std::string HumanPlayer::getName() {
     return this->name;
 }
 
-int HumanPlayer::getBalance() {
-    return this->balance;
-}
-
-void HumanPlayer::addChips(int amount) {
-    this->balance += amount;
-}
-
-bool HumanPlayer::removeChips(int amount) {
-    if (amount > this->balance) {
-        return false;
-    }
-    this->balance -= amount;
-    return true;
-}
-
-void HumanPlayer::receiveCard(Card card) {
-    this->hand.push_back(card);
-}
-
-std::vector<Card>& HumanPlayer::getHand() {
-    return this->hand;
-}
-
-void HumanPlayer::clearHand() {
-    this->hand.clear();
-}
-
 Action HumanPlayer::makeDecision(GameState& state) {
+    int seat = state.currentPlayerIndex;
+    int balance = state.seats.balance[seat];
+    int currentBet = state.seats.currentBet[seat];
     int minRaise = state.currentBet + state.smallBlind;
     int totalBetNeeded = minRaise;
-    this->view->displayPlayerActionMenu(state, this->balance, totalBetNeeded);
+    this->view->displayPlayerActionMenu(state, balance, totalBetNeeded);
     
     int choice = this->view->getMenuChoice(1, 5);
     Action action;
@@ -52,7 +27,7 @@ Action HumanPlayer::makeDecision(GameState& state) {
     switch (choice) {
         case 1: {
             int minBet = state.currentBet + state.smallBlind;
-            int maxBet = this->balance;
+            int maxBet = balance;
             int betAmount = this->view->getIntInput(
                 "Enter total bet amount: ", 
                 minBet, 
@@ -63,10 +38,10 @@ Action HumanPlayer::makeDecision(GameState& state) {
             break;
         }
         case 2: {
-            int callAmount = state.currentBet - this->currentBet;
-            if (callAmount >= this->balance) {
+            int callAmount = state.currentBet - currentBet;
+            if (callAmount >= balance) {
                 action.type = ACTION_ALL_IN;
-                action.amount = this->balance;
+                action.amount = balance;
             } else {
                 action.type = ACTION_CALL;
                 action.amount = callAmount;
@@ -74,7 +49,7 @@ Action HumanPlayer::makeDecision(GameState& state) {
             break;
         }
         case 3: {
-            if (state.currentBet == 0 || state.currentBet == this->currentBet) {
+            if (state.currentBet == 0 || state.currentBet == currentBet) {
                 action.type = ACTION_CHECK;
             } else {
                 action.type = ACTION_FOLD;
@@ -87,7 +62,7 @@ Action HumanPlayer::makeDecision(GameState& state) {
         }
         case 5: {
             action.type = ACTION_ALL_IN;
-            action.amount = this->balance;
+            action.amount = balance;
             break;
         }
         default:
@@ -97,24 +72,3 @@ Action HumanPlayer::makeDecision(GameState& state) {
     
     return action;
 }
-
-bool HumanPlayer::isActive() {
-    return this->active;
-}
-
-void HumanPlayer::setActive(bool active) {
-    this->active = active;
-}
-
-int HumanPlayer::getCurrentBet() {
-    return this->currentBet;
-}
-
-void HumanPlayer::setCurrentBet(int bet) {
-    this->currentBet = bet;
-}
-
-void HumanPlayer::resetCurrentBet() {
-    this->currentBet = 0;
-}
-
@@ -1,6 +1,5 @@
 #include "../../include/ui/TerminalView.h"
 #include "../../include/core/GameSettings.h"
-#include "../../include/interfaces/IPlayer.h"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
@@ -61,6 +60,21 @@ std::string TerminalView::rankToString(int rank)  {
     }
 }
 
+std::string TerminalView::handTypeToString(int handType) {
+    switch (handType) {
+        case 9: return "Royal Flush";
+        case 8: return "Straight Flush";
+        case 7: return "Four of a Kind";
+        case 6: return "Full House";
+        case 5: return "Flush";
+        case 4: return "Straight";
+        case 3: return "Three of a Kind";
+        case 2: return "Two Pair";
+        case 1: return "One Pair";
+        default: return "High Card";
+    }
+}
+
 std::string TerminalView::suitToSymbol(int suit)  {
     switch (suit) {
         case SUIT_SPADES: return "♠";
@@ -129,27 +143,27 @@ void TerminalView::displayGameState(GameState& state) {
     
     std::cout << "───────────────────────────────────────────────────────────────\n";
     std::cout << "PLAYERS:\n";
-    for (size_t i = 0; i < state.players.size(); ++i) {
-        auto player = state.players[i];
+    const SeatTable& seats = state.seats;
+    for (int i = 0; i < seats.count; ++i) {
         std::string prefix = "";
         if (i == state.dealerPosition) prefix = "(D) ";
-        else if (i == (state.dealerPosition + 1) % state.players.size()) prefix = "(SB) ";
-        else if (i == (state.dealerPosition + 2) % state.players.size()) prefix = "(BB) ";
+        else if (i == (state.dealerPosition + 1) % seats.count) prefix = "(SB) ";
+        else if (i == (state.dealerPosition + 2) % seats.count) prefix = "(BB) ";
         
         std::string marker = (i == state.currentPlayerIndex) ? " >>> " : "     ";
-        std::string activeMark = player->isActive() ? "[Active]" : "[Fold]";
+        std::string activeMark = seats.active[i] ? "[Active]" : "[Fold]";
         
         std::string normalizedPrefix = prefix;
         if (normalizedPrefix.length() < 4) {
             normalizedPrefix += std::string(4 - normalizedPrefix.length(), ' ');
         }
         
-        std::string balanceStr = "$" + std::to_string(player->getBalance());
-        std::string currentBetStr = "Current: $" + std::to_string(player->getCurrentBet());
+        std::string balanceStr = "$" + std::to_string(seats.balance[i]);
+        std::string currentBetStr = "Current: $" + std::to_string(seats.currentBet[i]);
         
         std::cout << marker 
                   << normalizedPrefix
-                  << std::left << std::setw(16) << player->getName()
+                  << std::left << std::setw(16) << seats.names[i]
                   << std::right << std::setw(10) << balanceStr
                   << "  " << std::left << std::setw(10) << activeMark
                   << std::right << std::setw(15) << currentBetStr;
@@ -159,9 +173,9 @@ void TerminalView::displayGameState(GameState& state) {
     }
     std::cout << "───────────────────────────────────────────────────────────────\n";
     
-    if (state.players.size() > 0 && state.players[0]->getHand().size() == 2) {
+    if (seats.count > 0 && seats.hand[0].size() == 2) {
         std::cout << "\n                      YOUR HAND\n";
-        auto hand = state.players[0]->getHand();
+        std::vector<Card> hand = seats.hand[0].toCards();
         std::cout << "              ┌─────┐ ┌─────┐\n";
         std::cout << "              │ ";
         printCard(hand[0]);
@@ -177,12 +191,54 @@ void TerminalView::displayGameState(GameState& state) {
     }
     
     if (state.outs.has_value() && !state.outs->empty()) {
-        std::cout << "Outs: ";
-        for ( auto& card : state.outs.value()) {
-            printCard(card);
-            std::cout << " ";
+        size_t totalOuts = 0;
+        for (const auto& group : state.outs.value()) {
+            totalOuts += group.cards.size();
+        }
+        std::cout << "Outs: " << totalOuts << "\n";
+        for (const auto& group : state.outs.value()) {
+            std::cout << "  " << handTypeToString(group.handType)
+                      << " (" << group.cards.size() << "): ";
+            for (const auto& card : group.cards) {
+                printCard(card);
+                std::cout << " ";
+            }
+            std::cout << "\n";
+        }
+    }
+    
+    if (state.drawOdds.has_value() && !state.drawOdds->empty()) {
+        bool onFlop = state.communityCards.size() == 3;
+        std::cout << (onFlop ? "Odds by river (this hand or better):\n" : "Odds on river (this hand or better):\n");
+        for (const auto& odds : state.drawOdds.value()) {
+            std::cout << "  " << std::left << std::setw(16) << handTypeToString(odds.handType) << std::right
+                      << std::fixed << std::setprecision(1) << odds.byRiver * 100 << "%";
+            if (onFlop) {
+                std::cout << "  (next card " << odds.nextCard * 100 << "%, runner-runner "
+                          << odds.runnerRunner * 100 << "%)";
+            }
+            std::cout << "\n";
+        }
+    }
+    
+    if (state.trueOuts.has_value()) {
+        const TrueOuts& trueOuts = state.trueOuts.value();
+        if (!trueOuts.winning.empty()) {
+            std::cout << "Outs to win vs shown hands (" << trueOuts.winning.size() << "): ";
+            for (const auto& card : trueOuts.winning) {
+                printCard(card);
+                std::cout << " ";
+            }
+            std::cout << "\n";
+        }
+        if (!trueOuts.tying.empty()) {
+            std::cout << "Outs to tie vs shown hands (" << trueOuts.tying.size() << "): ";
+            for (const auto& card : trueOuts.tying) {
+                printCard(card);
+                std::cout << " ";
+            }
+            std::cout << "\n";
         }
-        std::cout << "\n";
     }
     
     std::cout << "\n";
@@ -261,8 +317,8 @@ void TerminalView::displayPlayerActionMenu(GameState& state, int playerBalance,
     std::cout << BOLD << "YOUR ACTIONS:\n" << RESET;
     
     int playerCurrentBet = 0;
-    if (!state.players.empty()) {
-        playerCurrentBet = state.players[0]->getCurrentBet();
+    if (state.seats.count > 0) {
+        playerCurrentBet = state.seats.currentBet[0];
     }
     
     int callAmount = state.currentBet - playerCurrentBet;
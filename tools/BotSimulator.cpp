@@ -0,0 +1,75 @@
+// Headless bot-only games for measuring bot changes over many hands. Plays
+// a number of hands, topping busted seats back up, or a number of
+// tournaments played down to one seat, spread over independent tables on
+// every core. Each bot of the lineup is named by its difficulty on the
+// command line; cash results are reported in big blinds per 100 hands and
+// tournaments as the share won, both with 95% confidence intervals. The
+// seed is printed; passing it back with -s replays the batch exactly.
+//
+// g++ -std=c++17 -O2 -pthread -I./include tools/BotSimulator.cpp src/core/Card.cpp src/core/CardSet.cpp src/core/DealSampler.cpp src/core/DealSamplerAvx2.cpp src/core/Deck.cpp src/core/ThreadPool.cpp src/game/EquityCache.cpp src/game/EquityEngine.cpp src/game/HandEvaluator.cpp src/game/HandIndexer.cpp src/game/HandTables.cpp src/game/HandTablesAvx2.cpp src/game/HeadsUpMatrix.cpp src/game/PokerGame.cpp src/game/PreflopTable.cpp src/game/PreflopTableData.cpp src/game/RiverTable.cpp src/game/SimulationRunner.cpp src/players/BotPlayer.cpp src/players/HumanPlayer.cpp -o BotSimulator
+// ./BotSimulator 1000000 5 5 7 5
+// ./BotSimulator -t 10000 5 5 7 5
+// ./BotSimulator -s 12345 1000000 5 5 7 5
+
+#include "../include/core/SeatTable.h"
+#include "../include/game/SimulationRunner.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+int main(int argc, char** argv) {
+    GameSettings settings;
+    bool tournaments = false;
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-'; ++arg) {
+        if (std::strcmp(argv[arg], "-t") == 0) {
+            tournaments = true;
+        } else if (std::strcmp(argv[arg], "-s") == 0 && arg + 1 < argc) {
+            settings.seed = std::strtoull(argv[++arg], nullptr, 10);
+        } else {
+            break;
+        }
+    }
+    long long count = argc > arg ? std::atoll(argv[arg]) : (tournaments ? 1000 : 1000000);
+    for (int i = arg + 1; i < argc; ++i) {
+        settings.botDifficulties.push_back(std::atoi(argv[i]));
+    }
+    if (settings.botDifficulties.empty()) {
+        settings.botDifficulties.assign(4, settings.difficulty);
+    }
+    if (settings.botDifficulties.size() > SeatTable::MAX_SEATS) {
+        std::fprintf(stderr, "%s: at most %d bots fit at a table, got %zu\n", argv[0], SeatTable::MAX_SEATS,
+                     settings.botDifficulties.size());
+        return 1;
+    }
+    bool valid = count > 0 && settings.botDifficulties.size() >= 2;
+    for (int difficulty : settings.botDifficulties) {
+        valid = valid && difficulty >= 1 && difficulty <= 10;
+    }
+    if (!valid) {
+        std::fprintf(stderr, "usage: %s [-t] [-s seed] count difficulty difficulty [difficulty...]\n", argv[0]);
+        return 1;
+    }
+
+    SimulationRunner runner(settings);
+    BatchResult result = tournaments ? runner.runTournaments(static_cast<int>(count)) : runner.runHands(count);
+
+    std::printf("%lld hands", static_cast<long long>(result.hands));
+    if (tournaments) {
+        std::printf(" in %d tournaments", result.tournaments);
+    } else {
+        std::printf(" on %d tables", result.tables);
+    }
+    std::printf(", %.2f s, %.0f hands/s, seed %llu\n", result.seconds, result.hands / result.seconds,
+                static_cast<unsigned long long>(result.seed));
+    for (size_t bot = 0; bot < result.bots.size(); ++bot) {
+        const BotSummary& summary = result.bots[bot];
+        std::printf("Bot%-3zu difficulty %2d  ", bot + 1, summary.difficulty);
+        if (tournaments) {
+            std::printf("%6.2f%% +- %.2f%% won\n", summary.winRate * 100.0, summary.winRateError * 100.0);
+        } else {
+            std::printf("%+9.2f +- %.2f bb/100\n", summary.bbPer100, summary.bbPer100Error);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+// Single-core throughput of the scalar and AVX2 batch hand evaluators on
+// random seven-card hands.
+//
+// g++ -std=c++17 -O2 -I./include tools/EvaluatorBenchmark.cpp src/core/Card.cpp src/core/CardSet.cpp src/game/HandTables.cpp src/game/HandTablesAvx2.cpp -o EvaluatorBenchmark
+// ./EvaluatorBenchmark
+
+#include "../include/core/FastRandom.h"
+#include "../include/game/HandTables.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+static const int NUM_HANDS = 1 << 20;
+static const int ROUNDS = 20;
+
+template <typename Kernel>
+static double handsPerSecond(const std::vector<uint64_t>& masks, std::vector<int32_t>& values, Kernel kernel) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < ROUNDS; ++round) {
+        kernel(masks.data(), values.data(), NUM_HANDS);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<double>(NUM_HANDS) * ROUNDS / seconds;
+}
+
+int main() {
+    const HandTables& tables = HandTables::instance();
+
+    FastRandom rng(7);
+    std::vector<uint64_t> masks(NUM_HANDS);
+    for (auto& mask : masks) {
+        CardSet hand;
+        while (hand.size() < 7) {
+            hand.insert(Card::fromIndex(rng.nextBelow(Card::NUM_CARDS)));
+        }
+        mask = hand.mask();
+    }
+
+    std::vector<int32_t> scalarValues(NUM_HANDS), batchValues(NUM_HANDS);
+    double scalar = handsPerSecond(masks, scalarValues, [&](const uint64_t* m, int32_t* v, int n) {
+        tables.evaluateBatchScalar(m, v, n);
+    });
+    std::printf("scalar: %.1f M hands/s\n", scalar / 1e6);
+
+    if (!HandTables::hasAvx2()) {
+        std::printf("avx2:   not supported by this CPU\n");
+        return 0;
+    }
+
+    double avx2 = handsPerSecond(masks, batchValues, [&](const uint64_t* m, int32_t* v, int n) {
+        tables.evaluateBatchAvx2(m, v, n);
+    });
+    std::printf("avx2:   %.1f M hands/s\n", avx2 / 1e6);
+    std::printf("results %s\n", scalarValues == batchValues ? "match" : "DIFFER");
+    return scalarValues == batchValues ? 0 : 1;
+}
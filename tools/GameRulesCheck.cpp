@@ -0,0 +1,283 @@
+// Betting-rule checks for the game engine. Bot-only cash games and
+// tournaments are played through a view that inspects the table at every
+// decision and every action message:
+// - chips are conserved: balances plus the pot never change within a hand,
+//   and a tournament table always holds every starting chip;
+// - the table bet is the largest bet made, so a short blind or all-in never
+//   lowers it;
+// - every postflop street starts with no bets;
+// - blinds come from two seats that were dealt in;
+// - a busted seat is never in the hand, so bots do not count it as an
+//   opponent once a tournament table shrinks;
+// - a check is only accepted when the player has matched the bet;
+// - no street sees more than three raises;
+// - a street only ends once everyone still holding chips has matched;
+// - the board is complete whenever two or more players reach the payout;
+// - every hand ends within a bounded number of actions.
+// Exits non-zero if a check fails.
+//
+// g++ -std=c++17 -O2 -pthread -I./include tools/GameRulesCheck.cpp src/core/Card.cpp src/core/CardSet.cpp src/core/DealSampler.cpp src/core/DealSamplerAvx2.cpp src/core/Deck.cpp src/core/ThreadPool.cpp src/game/EquityCache.cpp src/game/EquityEngine.cpp src/game/HandEvaluator.cpp src/game/HandIndexer.cpp src/game/HandTables.cpp src/game/HandTablesAvx2.cpp src/game/HeadsUpMatrix.cpp src/game/PokerGame.cpp src/game/PreflopTable.cpp src/game/PreflopTableData.cpp src/game/RiverTable.cpp src/players/BotPlayer.cpp src/players/HumanPlayer.cpp -o GameRulesCheck
+// ./GameRulesCheck
+
+#include "../include/game/PokerGame.h"
+#include "../include/ui/NullView.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+static const int MAX_RAISES = 3;
+// Decisions in a hand, far above the longest legal one: four streets, eight
+// seats, capped raises.
+static const int MAX_ACTIONS = 1000;
+
+enum {
+    CHECK_CHIPS,
+    CHECK_TABLE_BET,
+    CHECK_STREET_RESET,
+    CHECK_BLINDS,
+    CHECK_BUSTED,
+    CHECK_CHECK,
+    CHECK_RAISE_CAP,
+    CHECK_STREET_END,
+    CHECK_BOARD,
+    CHECK_HAND_ENDS,
+    NUM_CHECKS
+};
+
+static const char* CHECK_NAMES[NUM_CHECKS] = {
+    "chips conserved",
+    "table bet is the top bet",
+    "streets start unbet",
+    "blinds from dealt seats",
+    "busted seats sit out",
+    "checks only when matched",
+    "at most three raises",
+    "streets end matched",
+    "board dealt before payout",
+    "hands end",
+};
+
+struct Lineup {
+    const char* name;
+    std::vector<int> difficulties;
+    int hands;
+    int tournaments;
+};
+
+static const Lineup LINEUPS[] = {
+    {"heads-up, weak", {1, 2}, 20000, 50},
+    {"four seats", {5, 5, 7, 5}, 5000, 10},
+    {"full table", {1, 3, 9, 8, 2, 6, 10, 4}, 3000, 5},
+};
+
+// Checks the table at every callback. Only the view sees the game between
+// actions, so a street's end is judged from the last action before the
+// next street's first display.
+class RulesCheckView : public NullView {
+    const GameState* state_ = nullptr;
+    int64_t tableChips_ = 0;
+    int64_t handChips_ = -1;
+    int boardSize_ = -1;
+    int raises_ = 0;
+    int actions_ = 0;
+    // The table right after the last action of the street, if there was one.
+    bool afterAction_ = false;
+    int lastTableBet_ = 0;
+    int32_t lastBet_[SeatTable::MAX_SEATS] = {};
+    int32_t lastBalance_[SeatTable::MAX_SEATS] = {};
+    bool lastInHand_[SeatTable::MAX_SEATS] = {};
+
+    int64_t chipsOnTable() const {
+        int64_t chips = this->state_->pot;
+        for (int seat = 0; seat < this->state_->seats.count; ++seat) {
+            chips += this->state_->seats.balance[seat];
+        }
+        return chips;
+    }
+
+    int seatsInHand() const {
+        int count = 0;
+        for (int seat = 0; seat < this->state_->seats.count; ++seat) {
+            if (this->state_->seats.inHand(seat)) count++;
+        }
+        return count;
+    }
+
+    void expect(int check, bool ok) {
+        if (!ok) this->failures[check]++;
+    }
+
+    void checkBets() {
+        const SeatTable& seats = this->state_->seats;
+        int top = 0;
+        for (int seat = 0; seat < seats.count; ++seat) {
+            top = std::max(top, static_cast<int>(seats.currentBet[seat]));
+        }
+        this->expect(CHECK_TABLE_BET, this->state_->currentBet == top);
+        for (int seat = 0; seat < seats.count; ++seat) {
+            this->expect(CHECK_BUSTED, !seats.active[seat] || seats.inHand(seat));
+        }
+        if (this->handChips_ >= 0) {
+            this->expect(CHECK_CHIPS, this->chipsOnTable() == this->handChips_);
+        }
+    }
+
+    // Bets are cleared as a street closes, so the street's end is judged
+    // from the table as its last action left it.
+    void checkStreetEnded() {
+        if (!this->afterAction_) return;
+        int inHand = 0;
+        for (int seat = 0; seat < this->state_->seats.count; ++seat) {
+            inHand += this->lastInHand_[seat];
+        }
+        if (inHand <= 1) return;
+        for (int seat = 0; seat < this->state_->seats.count; ++seat) {
+            if (this->lastInHand_[seat] && this->lastBalance_[seat] > 0) {
+                this->expect(CHECK_STREET_END, this->lastBet_[seat] == this->lastTableBet_);
+            }
+        }
+    }
+
+    void resetHand() {
+        this->handChips_ = -1;
+        this->boardSize_ = -1;
+        this->raises_ = 0;
+        this->actions_ = 0;
+        this->afterAction_ = false;
+    }
+
+    void startHand() {
+        const SeatTable& seats = this->state_->seats;
+        this->handChips_ = this->chipsOnTable();
+        if (this->tableChips_ > 0) {
+            this->expect(CHECK_CHIPS, this->handChips_ == this->tableChips_);
+        }
+        int dealt = 0;
+        int blinds = 0;
+        bool blindsDealt = true;
+        for (int seat = 0; seat < seats.count; ++seat) {
+            dealt += seats.hand[seat].size() == 2;
+            if (seats.currentBet[seat] > 0) {
+                blinds++;
+                blindsDealt = blindsDealt && seats.hand[seat].size() == 2;
+            }
+        }
+        this->expect(CHECK_BLINDS, blindsDealt && blinds == std::min(dealt, 2));
+    }
+
+    void endHand() {
+        this->checkStreetEnded();
+        if (this->seatsInHand() > 1) {
+            this->expect(CHECK_BOARD, this->state_->communityCards.size() == 5);
+        }
+        // The pot has been paid out but not yet cleared.
+        if (this->handChips_ >= 0) {
+            this->expect(CHECK_CHIPS, this->chipsOnTable() - this->state_->pot == this->handChips_);
+        }
+        this->resetHand();
+    }
+
+    void action(const std::string& message) {
+        const SeatTable& seats = this->state_->seats;
+        int seat = this->state_->currentPlayerIndex;
+        if (message.find(" checks.") != std::string::npos) {
+            this->expect(CHECK_CHECK, seats.currentBet[seat] == this->state_->currentBet || seats.balance[seat] == 0);
+        }
+        if (message.find(" raises to ") != std::string::npos || message.find(" bets to ") != std::string::npos) {
+            this->expect(CHECK_RAISE_CAP, ++this->raises_ <= MAX_RAISES);
+        }
+        this->checkBets();
+        this->afterAction_ = true;
+        this->lastTableBet_ = this->state_->currentBet;
+        for (int i = 0; i < seats.count; ++i) {
+            this->lastBet_[i] = seats.currentBet[i];
+            this->lastBalance_[i] = seats.balance[i];
+            this->lastInHand_[i] = seats.inHand(i);
+        }
+    }
+
+public:
+    int64_t failures[NUM_CHECKS] = {};
+
+    // tableChips is the fixed chip total of a tournament, 0 when busted
+    // seats are topped up between hands.
+    void watch(const GameState& state, int64_t tableChips) {
+        this->state_ = &state;
+        this->tableChips_ = tableChips;
+        this->resetHand();
+    }
+
+    // Every decision is shown first, even one that changes nothing and so
+    // prints no message.
+    void displayGameState(GameState& /*state*/) override {
+        if (++this->actions_ > MAX_ACTIONS) {
+            this->failures[CHECK_HAND_ENDS]++;
+            throw std::runtime_error("hand did not end");
+        }
+        int board = static_cast<int>(this->state_->communityCards.size());
+        if (this->boardSize_ < 0) {
+            this->boardSize_ = board;
+            if (board == 0) this->startHand();
+        } else if (board != this->boardSize_) {
+            this->checkStreetEnded();
+            this->boardSize_ = board;
+            this->raises_ = 0;
+            this->afterAction_ = false;
+            bool unbet = this->state_->currentBet == 0;
+            for (int seat = 0; seat < this->state_->seats.count; ++seat) {
+                unbet = unbet && this->state_->seats.currentBet[seat] == 0;
+            }
+            this->expect(CHECK_STREET_RESET, unbet);
+        }
+        this->checkBets();
+    }
+
+    void displayMessage(std::string message) override {
+        if (message.find(" wins $") != std::string::npos || message.find(" tie and split $") != std::string::npos ||
+            message == "No active players!") {
+            this->endHand();
+        } else if (message.find("Showdown!") == std::string::npos) {
+            this->action(message);
+        }
+    }
+};
+
+int main() {
+    auto view = std::make_shared<RulesCheckView>();
+    int64_t hands = 0;
+    int tournaments = 0;
+    uint64_t seed = 0;
+    for (const Lineup& lineup : LINEUPS) {
+        for (int mode = 0; mode < 2; ++mode) {
+            GameSettings settings;
+            settings.humanPlayer = false;
+            settings.calculateWinChance = false;
+            settings.showOuts = false;
+            settings.botDifficulties = lineup.difficulties;
+            settings.numBots = static_cast<int>(lineup.difficulties.size());
+            settings.seed = ++seed;
+
+            PokerGame game(view, settings, std::make_shared<HandEvaluator>(false));
+            bool tournament = mode == 1;
+            view->watch(game.getState(), tournament ? static_cast<int64_t>(settings.startingBalance) * settings.numBots : 0);
+            try {
+                SimulationResult result = tournament ? game.simulateTournaments(lineup.tournaments) : game.simulate(lineup.hands);
+                hands += result.hands;
+                tournaments += result.tournaments;
+            } catch (const std::exception& error) {
+                std::printf("%-16s %s: %s\n", lineup.name, tournament ? "tournaments" : "cash", error.what());
+            }
+        }
+    }
+
+    std::printf("%lld hands, %d tournaments\n", static_cast<long long>(hands), tournaments);
+    bool ok = true;
+    for (int check = 0; check < NUM_CHECKS; ++check) {
+        std::printf("%-28s %8lld violations  %s\n", CHECK_NAMES[check], static_cast<long long>(view->failures[check]),
+                    view->failures[check] ? "FAIL" : "ok");
+        ok = ok && view->failures[check] == 0;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+// Round-trip check of HandIndexer for every betting round: each index of
+// each table is unindexed to its canonical (hole, board) pair, which must
+// have the right card counts, no shared cards, and index back to the same
+// value. Random deals, and the same deals with their suits relabelled, must
+// land on one index below size(). Exits non-zero if a check fails.
+//
+// g++ -std=c++17 -O2 -pthread -I./include tools/HandIndexerCheck.cpp src/core/Card.cpp src/core/CardSet.cpp src/core/ThreadPool.cpp src/game/HandIndexer.cpp -o HandIndexerCheck
+// ./HandIndexerCheck
+
+#include "../include/core/FastRandom.h"
+#include "../include/core/ThreadPool.h"
+#include "../include/game/HandIndexer.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+static const int CHUNKS = 256;
+static const int RANDOM_DEALS = 1 << 20;
+
+struct Round {
+    const char* name;
+    int holeCards;
+    int boardCards;
+    uint64_t classes;
+};
+
+static const Round ROUNDS[] = {
+    {"preflop", 2, 0, 169},
+    {"flop boards", 0, 3, 1755},
+    {"flop", 2, 3, 1286792},
+    {"turn", 2, 4, 13960050},
+    {"river", 2, 5, 123156254},
+};
+
+static CardSet relabelSuits(CardSet cards, const int* suits) {
+    uint64_t mask = 0;
+    for (int suit = 0; suit < 4; ++suit) {
+        mask |= static_cast<uint64_t>(cards.suitMask(suit)) << (suits[suit] * 16);
+    }
+    return CardSet(mask);
+}
+
+static CardSet drawCards(FastRandom& rng, CardSet& live, int count) {
+    CardSet drawn;
+    while (drawn.size() < count) {
+        Card card = Card::fromIndex(static_cast<int>(rng.nextBelow(Card::NUM_CARDS)));
+        if (live.contains(card)) {
+            live.remove(card);
+            drawn.insert(card);
+        }
+    }
+    return drawn;
+}
+
+// Every index must survive unindex and re-index unchanged.
+static int64_t roundTripMismatches(const HandIndexer& indexer) {
+    std::vector<int64_t> mismatches(CHUNKS, 0);
+    uint64_t size = indexer.size();
+    ThreadPool::instance().parallelFor(CHUNKS, [&](int chunk) {
+        uint64_t begin = size * chunk / CHUNKS;
+        uint64_t end = size * (chunk + 1) / CHUNKS;
+        for (uint64_t index = begin; index < end; ++index) {
+            CardSet hole, board;
+            indexer.unindex(index, hole, board);
+            if (hole.size() != indexer.holeCards() || board.size() != indexer.boardCards() ||
+                hole.intersects(board) || indexer.index(hole, board) != index) {
+                mismatches[chunk]++;
+            }
+        }
+    });
+    int64_t total = 0;
+    for (int64_t count : mismatches) {
+        total += count;
+    }
+    return total;
+}
+
+// Relabelling the suits of a deal must not move its index.
+static int64_t relabelMismatches(const HandIndexer& indexer, uint64_t seed) {
+    FastRandom rng(seed);
+    int64_t mismatches = 0;
+    for (int deal = 0; deal < RANDOM_DEALS; ++deal) {
+        CardSet live = CardSet::fullDeck();
+        CardSet hole = drawCards(rng, live, indexer.holeCards());
+        CardSet board = drawCards(rng, live, indexer.boardCards());
+        int suits[4] = {0, 1, 2, 3};
+        for (int i = 3; i > 0; --i) {
+            std::swap(suits[i], suits[rng.nextBelow(i + 1)]);
+        }
+        uint64_t index = indexer.index(hole, board);
+        if (index >= indexer.size() ||
+            indexer.index(relabelSuits(hole, suits), relabelSuits(board, suits)) != index) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+int main() {
+    bool ok = true;
+    for (const Round& round : ROUNDS) {
+        auto start = std::chrono::steady_clock::now();
+        const HandIndexer& indexer = HandIndexer::instance(round.holeCards, round.boardCards);
+        bool sizeOk = indexer.size() == round.classes;
+        int64_t roundTrip = roundTripMismatches(indexer);
+        int64_t relabel = relabelMismatches(indexer, round.classes);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        bool roundOk = sizeOk && roundTrip == 0 && relabel == 0;
+        std::printf("%-12s %11llu classes%s  %lld round-trip and %lld relabel mismatches  %6.1f s  %s\n",
+                    round.name, static_cast<unsigned long long>(indexer.size()), sizeOk ? "" : " (wrong count)",
+                    static_cast<long long>(roundTrip), static_cast<long long>(relabel), seconds,
+                    roundOk ? "ok" : "FAIL");
+        ok = ok && roundOk;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,109 @@
+// Offline generator for the heads-up preflop equity matrix loaded by
+// HeadsUpMatrix. Every ordered pair of non-conflicting combos is reduced to a
+// canonical representative under the 24 suit permutations, each canonical
+// pair is enumerated exactly over all 1,712,304 boards, and the result is
+// written as a versioned binary file.
+//
+// g++ -std=c++17 -O2 -pthread -I./include tools/HeadsUpMatrixGenerator.cpp src/core/Card.cpp src/core/CardSet.cpp src/core/DealSampler.cpp src/core/DealSamplerAvx2.cpp src/core/ThreadPool.cpp src/game/EquityEngine.cpp src/game/HandTables.cpp src/game/HandTablesAvx2.cpp src/game/HeadsUpMatrix.cpp -o HeadsUpMatrixGenerator
+// ./HeadsUpMatrixGenerator data/headsup_equity.bin
+
+#include "../include/core/ThreadPool.h"
+#include "../include/game/EquityEngine.h"
+#include "../include/game/HeadsUpMatrix.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+static const int NUM_COMBOS = HeadsUpMatrix::NUM_COMBOS;
+
+static int permuteCard(int index, const int permutation[4]) {
+    return (index & ~3) | permutation[index & 3];
+}
+
+// Smallest (hero, villain) combo pair reachable by relabelling suits.
+static uint32_t canonicalPair(int heroCombo, int villainCombo, const std::vector<std::vector<int>>& permutations,
+                              const std::vector<int>& comboLow, const std::vector<int>& comboHigh) {
+    uint32_t best = UINT32_MAX;
+    for (const auto& permutation : permutations) {
+        int hero = HeadsUpMatrix::comboIndex(permuteCard(comboHigh[heroCombo], permutation.data()),
+                                             permuteCard(comboLow[heroCombo], permutation.data()));
+        int villain = HeadsUpMatrix::comboIndex(permuteCard(comboHigh[villainCombo], permutation.data()),
+                                                permuteCard(comboLow[villainCombo], permutation.data()));
+        best = std::min(best, static_cast<uint32_t>(hero * NUM_COMBOS + villain));
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    const char* path = argc > 1 ? argv[1] : "headsup_equity.bin";
+
+    std::vector<int> comboLow(NUM_COMBOS), comboHigh(NUM_COMBOS);
+    std::vector<CardSet> comboSets(NUM_COMBOS);
+    for (int combo = 0; combo < NUM_COMBOS; ++combo) {
+        comboSets[combo] = HeadsUpMatrix::comboCards(combo);
+        auto it = comboSets[combo].begin();
+        int first = (*it).getIndex();
+        ++it;
+        int second = (*it).getIndex();
+        comboLow[combo] = std::min(first, second);
+        comboHigh[combo] = std::max(first, second);
+    }
+
+    std::vector<std::vector<int>> permutations;
+    std::vector<int> permutation = {0, 1, 2, 3};
+    do {
+        permutations.push_back(permutation);
+    } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+    // Canonical pair of every (i, j) with i < j; each distinct canonical pair
+    // is enumerated once and (j, i) is filled in as 1 - equity.
+    std::vector<uint32_t> canonical(static_cast<size_t>(NUM_COMBOS) * NUM_COMBOS, UINT32_MAX);
+    std::vector<char> queued(static_cast<size_t>(NUM_COMBOS) * NUM_COMBOS, 0);
+    std::vector<uint32_t> jobs;
+    for (int i = 0; i < NUM_COMBOS; ++i) {
+        for (int j = i + 1; j < NUM_COMBOS; ++j) {
+            if (comboSets[i].intersects(comboSets[j])) continue;
+            uint32_t key = canonicalPair(i, j, permutations, comboLow, comboHigh);
+            canonical[static_cast<size_t>(i) * NUM_COMBOS + j] = key;
+            if (!queued[key]) {
+                queued[key] = 1;
+                jobs.push_back(key);
+            }
+        }
+    }
+    std::fprintf(stderr, "%zu canonical pairs\n", jobs.size());
+
+    std::vector<uint16_t> results(static_cast<size_t>(NUM_COMBOS) * NUM_COMBOS, 0);
+    // One task per canonical pair on the shared pool; the enumeration inside
+    // handVsHand queues its board chunks on the same workers instead of
+    // starting threads of its own.
+    ThreadPool::instance().parallelFor(static_cast<int>(jobs.size()), [&](int job) {
+        EquityEngine engine;
+        uint32_t key = jobs[job];
+        EquityResult result = engine.handVsHand(comboSets[key / NUM_COMBOS], comboSets[key % NUM_COMBOS], CardSet());
+        results[key] = static_cast<uint16_t>(result.equity * HeadsUpMatrix::EQUITY_SCALE + 0.5f);
+    });
+
+    std::vector<uint16_t> matrix(static_cast<size_t>(NUM_COMBOS) * NUM_COMBOS, 0);
+    for (int i = 0; i < NUM_COMBOS; ++i) {
+        for (int j = i + 1; j < NUM_COMBOS; ++j) {
+            uint32_t key = canonical[static_cast<size_t>(i) * NUM_COMBOS + j];
+            if (key == UINT32_MAX) continue;
+            uint16_t value = results[key];
+            matrix[static_cast<size_t>(i) * NUM_COMBOS + j] = value;
+            matrix[static_cast<size_t>(j) * NUM_COMBOS + i] = HeadsUpMatrix::EQUITY_SCALE - value;
+        }
+    }
+
+    FILE* file = std::fopen(path, "wb");
+    if (!file) {
+        std::fprintf(stderr, "cannot open %s\n", path);
+        return 1;
+    }
+    HeadsUpMatrix::FileHeader header = {HeadsUpMatrix::FILE_MAGIC, HeadsUpMatrix::FILE_VERSION,
+                                        NUM_COMBOS, HeadsUpMatrix::EQUITY_SCALE};
+    std::fwrite(&header, sizeof(header), 1, file);
+    std::fwrite(matrix.data(), sizeof(uint16_t), matrix.size(), file);
+    std::fclose(file);
+    return 0;
+}
@@ -0,0 +1,72 @@
+// Offline generator for src/game/PreflopTableData.cpp.
+//
+// g++ -std=c++17 -O2 -pthread -I./include tools/PreflopTableGenerator.cpp src/core/Card.cpp src/core/CardSet.cpp src/core/DealSampler.cpp src/core/DealSamplerAvx2.cpp src/core/ThreadPool.cpp src/game/EquityEngine.cpp src/game/HandTables.cpp src/game/HandTablesAvx2.cpp -o PreflopTableGenerator
+// ./PreflopTableGenerator > src/game/PreflopTableData.cpp
+
+#include "../include/game/EquityEngine.h"
+#include "../include/game/PreflopTable.h"
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+static const uint64_t GENERATOR_SEED = 0x5EED0169ull;
+
+static CardSet representative(int classIndex) {
+    int row = classIndex / 13 + RANK_TWO;
+    int col = classIndex % 13 + RANK_TWO;
+    if (row == col) {
+        return CardSet(Card(row, SUIT_SPADES).getBit() | Card(col, SUIT_HEARTS).getBit());
+    }
+    if (row > col) {
+        return CardSet(Card(row, SUIT_SPADES).getBit() | Card(col, SUIT_SPADES).getBit());
+    }
+    return CardSet(Card(col, SUIT_SPADES).getBit() | Card(row, SUIT_HEARTS).getBit());
+}
+
+int main() {
+    EquityBudget budget;
+    budget.minSamples = 100000;
+    budget.maxSamples = 4000000;
+    budget.maxMillis = 1e9;
+    budget.targetStandardError = 0.0005;
+
+    const int total = PreflopTable::NUM_CLASSES * PreflopTable::MAX_OPPONENTS;
+    std::vector<uint16_t> table(total, 0);
+    std::atomic<int> next(0);
+
+    auto worker = [&]() {
+        EquityEngine engine;
+        for (int job = next++; job < total; job = next++) {
+            int classIndex = job / PreflopTable::MAX_OPPONENTS;
+            int numOpponents = job % PreflopTable::MAX_OPPONENTS + 1;
+            engine.seed(GENERATOR_SEED + job);
+            EquityResult result = engine.monteCarloEquity(representative(classIndex), CardSet(), numOpponents, budget);
+            table[job] = static_cast<uint16_t>(result.equity * PreflopTable::EQUITY_SCALE + 0.5f);
+        }
+    };
+
+    unsigned numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 1;
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < numThreads; ++i) {
+        threads.emplace_back(worker);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::printf("// Generated by tools/PreflopTableGenerator.cpp; do not edit by hand.\n");
+    std::printf("// Monte Carlo all-in equity, standard error <= 0.0005 per entry.\n\n");
+    std::printf("#include \"../../include/game/PreflopTable.h\"\n\n");
+    std::printf("const uint16_t PREFLOP_EQUITY[PreflopTable::NUM_CLASSES][PreflopTable::MAX_OPPONENTS] = {\n");
+    for (int c = 0; c < PreflopTable::NUM_CLASSES; ++c) {
+        std::printf("    {");
+        for (int o = 0; o < PreflopTable::MAX_OPPONENTS; ++o) {
+            std::printf("%s%5u", o == 0 ? "" : ", ", table[c * PreflopTable::MAX_OPPONENTS + o]);
+        }
+        std::printf("},\n");
+    }
+    std::printf("};\n");
+    return 0;
+}